@@ -0,0 +1,71 @@
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+
+#include "matrixes/matrix.h"
+
+// Fills matrix with reproducible values, integers are kept small so products don't overflow
+template<MatrixT M>
+M &FillRandom(M &matrix, unsigned seed = 42)
+{
+	using T = typename M::contained;
+
+	std::mt19937 generator{seed};
+	for (std::size_t row = 0; row < matrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < matrix.Cols(); col++)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				matrix(row, col) = std::uniform_real_distribution<T>{T{-1}, T{1}}(generator);
+			}
+			else
+			{
+				matrix(row, col) = static_cast<T>(std::uniform_int_distribution<int>{-9, 9}(generator));
+			}
+		}
+	}
+	return matrix;
+}
+
+template<typename T>
+MxLib::Matrix<T> RandomMatrix(std::size_t rows, std::size_t cols, unsigned seed = 42)
+{
+	MxLib::Matrix<T> matrix{rows, cols};
+	return FillRandom(matrix, seed);
+}
+
+// Square matrixes have side of benchmark range argument
+template<typename T>
+MxLib::Matrix<T> RandomSquareMatrix(const benchmark::State &state, unsigned seed = 42)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	return RandomMatrix<T>(rank, rank, seed);
+}
+
+// Floating point operations per second of the whole run
+inline void SetFlops(benchmark::State &state, double operationsPerIteration)
+{
+	state.counters["FLOPS"] = benchmark::Counter(operationsPerIteration, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Bytes read and written per second, for operations limited by memory
+inline void SetBytes(benchmark::State &state, std::size_t bytesPerIteration)
+{
+	state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(bytesPerIteration));
+}
+
+template<MatrixT M>
+inline void KeepResult(M &matrix)
+{
+	benchmark::DoNotOptimize(matrix.data());
+	benchmark::ClobberMemory();
+}
+
+#endif // BENCH_COMMON_H
@@ -0,0 +1,152 @@
+#include <cmath>
+#include <cstdint>
+
+#include "bench_common.h"
+#include "matrixes/algorithms.h"
+
+using namespace MxLib;
+
+// Random matrix with dominant diagonal, it is never singular
+template<typename T>
+static Matrix<T> InvertibleMatrix(const benchmark::State &state)
+{
+	Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	for (std::size_t i = 0; i < matrix.Rows(); i++)
+	{
+		matrix(i, i) += static_cast<T>(matrix.Rows());
+	}
+	return matrix;
+}
+
+template<typename T>
+static void BM_Transpose(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> transposed{algo::Transpose(matrix)};
+		KeepResult(transposed);
+	}
+
+	SetBytes(state, 2 * matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Transpose, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_Transpose, double)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_Transpose, int)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_TransposeInplace(benchmark::State &state)
+{
+	Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		algo::TransposeInplace(matrix);
+		KeepResult(matrix);
+	}
+
+	SetBytes(state, 2 * matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_TransposeInplace, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_TransposeInplace, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_Determinant(benchmark::State &state)
+{
+	const Matrix<T> matrix{InvertibleMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(algo::Determinant(matrix));
+	}
+
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank / 3);
+}
+BENCHMARK_TEMPLATE(BM_Determinant, float)->RangeMultiplier(2)->Range(8, 512);
+BENCHMARK_TEMPLATE(BM_Determinant, double)->RangeMultiplier(2)->Range(8, 512);
+// Exact integer determinant grows fast, bigger random matrixes overflow
+BENCHMARK_TEMPLATE(BM_Determinant, std::int64_t)->DenseRange(4, 12, 4);
+
+template<typename T>
+static void BM_Adjoint(benchmark::State &state)
+{
+	const Matrix<T> matrix{InvertibleMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> adjoint{algo::Adjoint(matrix)};
+		KeepResult(adjoint);
+	}
+}
+BENCHMARK_TEMPLATE(BM_Adjoint, double)->RangeMultiplier(2)->Range(4, 64);
+BENCHMARK_TEMPLATE(BM_Adjoint, std::int64_t)->DenseRange(4, 12, 4);
+
+template<typename T>
+static void BM_Inverse(benchmark::State &state)
+{
+	const Matrix<T> matrix{InvertibleMatrix<T>(state)};
+	Matrix<T> inversed{matrix.Rows(), matrix.Cols()};
+
+	for (auto _ : state)
+	{
+		algo::Inverse(matrix, inversed);
+		KeepResult(inversed);
+	}
+
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_Inverse, float)->RangeMultiplier(2)->Range(8, 512);
+BENCHMARK_TEMPLATE(BM_Inverse, double)->RangeMultiplier(2)->Range(8, 512);
+
+template<typename T>
+static void BM_LU(benchmark::State &state)
+{
+	const Matrix<T> matrix{InvertibleMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		auto decomposition{algo::LU(matrix)};
+		KeepResult(decomposition.lu);
+	}
+
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank / 3);
+}
+BENCHMARK_TEMPLATE(BM_LU, double)->RangeMultiplier(2)->Range(8, 512);
+
+template<typename T>
+static void BM_Map(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> mapped{algo::Map(matrix, [](T value) { return value * value; })};
+		KeepResult(mapped);
+	}
+
+	SetBytes(state, 2 * matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Map, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_Map, double)->RangeMultiplier(4)->Range(64, 1024);
+
+// Function that costs much more than memory access, split between threads by rows
+template<typename T>
+static void BM_MapExpensive(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const auto execution{static_cast<algo::Execution>(state.range(1))};
+
+	for (auto _ : state)
+	{
+		Matrix<T> mapped{algo::Map(matrix, [](T value) { return std::exp(std::sin(value)) * std::log1p(value * value); }, execution)};
+		KeepResult(mapped);
+	}
+
+	SetBytes(state, 2 * matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MapExpensive, double)->ArgsProduct({{256, 1024}, {
+	static_cast<long>(algo::Execution::Sequential), static_cast<long>(algo::Execution::Parallel)}});
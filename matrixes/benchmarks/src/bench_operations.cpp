@@ -0,0 +1,267 @@
+#include "bench_common.h"
+#include "matrixes/operations.h"
+#include "matrixes/vector.h"
+
+using namespace MxLib;
+
+template<typename T>
+static void BM_DotProduct(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state, 2)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> result = lMatrix * rMatrix;
+		KeepResult(result);
+	}
+
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_DotProduct, float)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_DotProduct, double)->RangeMultiplier(2)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_DotProduct, int)->RangeMultiplier(2)->Range(16, 512);
+
+// Flops are counted as for classic product, so speedup shows as higher rate
+template<typename T>
+static void BM_StrassenDotProduct(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state, 2)};
+	strassen::SetEnabled(true);
+	strassen::SetCutoff(static_cast<std::size_t>(state.range(1)));
+
+	for (auto _ : state)
+	{
+		Matrix<T> result = lMatrix * rMatrix;
+		KeepResult(result);
+	}
+
+	strassen::SetEnabled(false);
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_StrassenDotProduct, double)->ArgsProduct({{1024, 2048, 4096}, {512, 1024}})->Unit(benchmark::kMillisecond);
+
+// Accumulating product into the same output every iteration, C = AB + C
+template<typename T>
+static void BM_GemmInto(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state, 2)};
+	Matrix<T> result{RandomSquareMatrix<T>(state, 3)};
+
+	for (auto _ : state)
+	{
+		Gemm(T{1}, lMatrix, rMatrix, T{1}, result);
+		KeepResult(result);
+	}
+
+	const auto rank{static_cast<double>(state.range(0))};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_GemmInto, float)->RangeMultiplier(4)->Range(16, 1024);
+BENCHMARK_TEMPLATE(BM_GemmInto, double)->RangeMultiplier(4)->Range(16, 1024);
+
+// Matrix by column vector
+template<typename T>
+static void BM_MatrixVectorProduct(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const Matrix<T> matrix{RandomMatrix<T>(rank, rank, 1)};
+	const Matrix<T> vector{RandomMatrix<T>(rank, 1, 2)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> result = matrix * vector;
+		KeepResult(result);
+	}
+
+	SetFlops(state, 2 * static_cast<double>(rank * rank));
+	SetBytes(state, rank * rank * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MatrixVectorProduct, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_MatrixVectorProduct, double)->RangeMultiplier(4)->Range(64, 4096);
+
+// Row vector by matrix and matrix by column of another matrix, both are matrix-vector products
+template<typename T>
+static void BM_VectorMatrixProduct(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const Matrix<T> matrix{RandomMatrix<T>(rank, rank, 1)};
+	const Matrix<T> values{RandomMatrix<T>(1, rank, 2)};
+	const Vector<T> vector(rank, values.data());
+
+	for (auto _ : state)
+	{
+		Vector<T> result = vector * matrix;
+		benchmark::DoNotOptimize(result.data());
+	}
+
+	SetFlops(state, 2 * static_cast<double>(rank * rank));
+	SetBytes(state, rank * rank * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_VectorMatrixProduct, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_VectorMatrixProduct, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_MatrixColViewProduct(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const Matrix<T> matrix{RandomMatrix<T>(rank, rank, 1)};
+	const Matrix<T> columns{RandomMatrix<T>(rank, 4, 2)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> result = matrix * ColView{columns, 1};
+		KeepResult(result);
+	}
+
+	SetFlops(state, 2 * static_cast<double>(rank * rank));
+	SetBytes(state, rank * rank * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MatrixColViewProduct, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_MatrixColViewProduct, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_Addition(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state, 2)};
+	Matrix<T> result{lMatrix.Rows(), lMatrix.Cols()};
+
+	for (auto _ : state)
+	{
+		result = lMatrix + rMatrix;
+		KeepResult(result);
+	}
+
+	SetFlops(state, static_cast<double>(result.size()));
+	SetBytes(state, 3 * result.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Addition, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_Addition, double)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_Addition, int)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_ElementwiseMultiply(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state, 2)};
+	Matrix<T> result{lMatrix.Rows(), lMatrix.Cols()};
+
+	for (auto _ : state)
+	{
+		result = Multiply(lMatrix, rMatrix);
+		KeepResult(result);
+	}
+
+	SetFlops(state, static_cast<double>(result.size()));
+	SetBytes(state, 3 * result.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_ElementwiseMultiply, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_ElementwiseMultiply, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_ScalarOperations(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	Matrix<T> result{matrix.Rows(), matrix.Cols()};
+
+	for (auto _ : state)
+	{
+		result = matrix * T{3};
+		KeepResult(result);
+		result = matrix / T{3};
+		KeepResult(result);
+		result = matrix + T{3};
+		KeepResult(result);
+		result = -matrix;
+		KeepResult(result);
+	}
+
+	SetFlops(state, 4 * static_cast<double>(result.size()));
+	SetBytes(state, 8 * result.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_ScalarOperations, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_ScalarOperations, double)->RangeMultiplier(4)->Range(64, 4096);
+
+// Same operations as above changing matrix in place
+template<typename T>
+static void BM_ScalarAssignmentOperations(benchmark::State &state)
+{
+	Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		matrix *= T{3};
+		KeepResult(matrix);
+		matrix /= T{3};
+		KeepResult(matrix);
+		matrix += T{3};
+		KeepResult(matrix);
+		matrix -= T{3};
+		KeepResult(matrix);
+	}
+
+	SetFlops(state, 4 * static_cast<double>(matrix.size()));
+	SetBytes(state, 8 * matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_ScalarAssignmentOperations, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_ScalarAssignmentOperations, double)->RangeMultiplier(4)->Range(64, 4096);
+
+// a + b * 2 - c * d / 4 chained in a single expression
+template<typename T>
+static void BM_ChainedExpression(benchmark::State &state)
+{
+	const Matrix<T> aMatrix{RandomSquareMatrix<T>(state, 1)};
+	const Matrix<T> bMatrix{RandomSquareMatrix<T>(state, 2)};
+	const Matrix<T> cMatrix{RandomSquareMatrix<T>(state, 3)};
+	const Matrix<T> dMatrix{RandomSquareMatrix<T>(state, 4)};
+	Matrix<T> result{aMatrix.Rows(), aMatrix.Cols()};
+
+	for (auto _ : state)
+	{
+		result = aMatrix + bMatrix * T{2} - Multiply(cMatrix, dMatrix) / T{4};
+		KeepResult(result);
+	}
+
+	SetFlops(state, 5 * static_cast<double>(result.size()));
+	SetBytes(state, 5 * result.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_ChainedExpression, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_ChainedExpression, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_Randomize(benchmark::State &state)
+{
+	Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		Randomize(matrix, T{-1}, T{1});
+		KeepResult(matrix);
+	}
+
+	SetBytes(state, matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_Randomize, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_Randomize, double)->RangeMultiplier(4)->Range(64, 1024);
+
+template<typename T>
+static void BM_RandomizeNormal(benchmark::State &state)
+{
+	Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	std::uint64_t seed = 0;
+	for (auto _ : state)
+	{
+		RandomizeNormal(matrix, T{0}, T{1}, seed++);
+		KeepResult(matrix);
+	}
+
+	SetBytes(state, matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_RandomizeNormal, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_RandomizeNormal, double)->RangeMultiplier(4)->Range(64, 1024);
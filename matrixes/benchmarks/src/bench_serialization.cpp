@@ -0,0 +1,144 @@
+#include <cstddef>
+#include <filesystem>
+
+#include <unistd.h>
+
+#include <fmt/format.h>
+#include <fmt/os.h>
+
+#include "bench_common.h"
+#include "matrixes/serialization.h"
+#include "matrixes/streaming.h"
+#include "matrixes/vector.h"
+
+using namespace MxLib;
+
+static std::filesystem::path BenchFile()
+{
+	return std::filesystem::temp_directory_path() / fmt::format("mathx_bench_{}.mxm", ::getpid());
+}
+
+// Text dump with fmt, that binary format replaces
+template<typename T>
+static void BM_SaveText(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::filesystem::path path = BenchFile();
+
+	for (auto _ : state)
+	{
+		auto out = fmt::output_file(path.string());
+		for (std::size_t row = 0; row < matrix.Rows(); ++row)
+		{
+			for (std::size_t col = 0; col < matrix.Cols(); ++col)
+			{
+				out.print("{} ", matrix(row, col));
+			}
+			out.print("\n");
+		}
+	}
+
+	SetBytes(state, matrix.size() * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_SaveText, double)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+template<typename T>
+static void BM_SaveBinary(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::filesystem::path path = BenchFile();
+
+	for (auto _ : state)
+	{
+		Save(path, matrix);
+	}
+
+	SetBytes(state, matrix.size() * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_SaveBinary, double)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+template<typename T>
+static void BM_LoadBinary(benchmark::State &state)
+{
+	const std::filesystem::path path = BenchFile();
+	Save(path, RandomSquareMatrix<T>(state));
+
+	for (auto _ : state)
+	{
+		Matrix<T> loaded = Load<Matrix<T>>(path);
+		KeepResult(loaded);
+	}
+
+	SetBytes(state, static_cast<std::size_t>(state.range(0) * state.range(0)) * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_LoadBinary, double)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+// Mapping itself reads nothing, so every element is read once to compare with loading
+template<typename T>
+static void BM_LoadMappedRead(benchmark::State &state)
+{
+	const std::filesystem::path path = BenchFile();
+	Save(path, RandomSquareMatrix<T>(state));
+
+	for (auto _ : state)
+	{
+		const MappedMatrix<T> mapped = LoadMapped<T>(path);
+		mapped.Advise(AccessPattern::Sequential);
+		T sum{};
+		for (std::size_t index = 0; index < mapped.size(); ++index)
+		{
+			sum += mapped.data()[index];
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+
+	SetBytes(state, static_cast<std::size_t>(state.range(0) * state.range(0)) * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_LoadMappedRead, double)->RangeMultiplier(4)->Range(256, 4096)->Unit(benchmark::kMillisecond);
+
+// Reading chunks alone, rate that streaming product should approach
+template<typename T>
+static void BM_StreamRowChunks(benchmark::State &state)
+{
+	const std::filesystem::path path = BenchFile();
+	Save(path, RandomSquareMatrix<T>(state));
+
+	for (auto _ : state)
+	{
+		const RowChunkStream<T> stream{path, std::size_t{8} << 20};
+		stream.ForEachChunk([](std::size_t /*unused*/, std::size_t /*unused*/, const T *rows) {
+			benchmark::DoNotOptimize(rows);
+		});
+	}
+
+	SetBytes(state, static_cast<std::size_t>(state.range(0) * state.range(0)) * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_StreamRowChunks, double)->RangeMultiplier(4)->Range(1024, 8192)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+template<typename T>
+static void BM_StreamingGemv(benchmark::State &state)
+{
+	const std::filesystem::path path = BenchFile();
+	Save(path, RandomSquareMatrix<T>(state));
+	const auto transposition = state.range(1) == 0 ? Transposition::None : Transposition::Transposed;
+	Vector<T> vector(static_cast<std::size_t>(state.range(0)));
+	for (std::size_t index = 0; index < vector.size(); ++index)
+	{
+		vector[index] = static_cast<T>(index % 7) - 3;
+	}
+
+	for (auto _ : state)
+	{
+		Vector<T> product = StreamingGemv(path, vector, transposition, std::size_t{8} << 20);
+		benchmark::DoNotOptimize(product.data());
+	}
+
+	SetBytes(state, static_cast<std::size_t>(state.range(0) * state.range(0)) * sizeof(T));
+	std::filesystem::remove(path);
+}
+BENCHMARK_TEMPLATE(BM_StreamingGemv, double)->ArgsProduct({{1024, 4096, 8192}, {0, 1}})->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <random>
+
+#include "bench_common.h"
+#include "matrixes/operations.h"
+#include "matrixes/sparse_matrix.h"
+#include "matrixes/vector.h"
+
+using namespace MxLib;
+
+// Square matrix with about 0.5% of elements stored, at random positions
+template<typename T>
+static SparseMatrix<T> RandomSparseMatrix(std::size_t rank)
+{
+	std::mt19937 generator{42};
+	std::uniform_int_distribution<std::size_t> position{0, rank - 1};
+	std::uniform_real_distribution<T> value{T{-1}, T{1}};
+	const std::size_t perRow = std::max<std::size_t>(rank / 200, 1);
+
+	SparseMatrixBuilder<T> builder{rank, rank};
+	builder.Reserve(rank * perRow);
+	for (std::size_t row = 0; row < rank; ++row)
+	{
+		for (std::size_t element = 0; element < perRow; ++element)
+		{
+			builder.Add(row, position(generator), value(generator));
+		}
+	}
+	return builder.Build();
+}
+
+template<typename T>
+static void BM_SparseTimesVector(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const SparseMatrix<T> sparse = RandomSparseMatrix<T>(rank);
+	Vector<T> vector(rank);
+	for (std::size_t index = 0; index < rank; ++index)
+	{
+		vector[index] = static_cast<T>(index % 7) - 3;
+	}
+
+	for (auto _ : state)
+	{
+		Vector<T> product = sparse * vector;
+		benchmark::DoNotOptimize(product.data());
+	}
+
+	SetFlops(state, 2.0 * static_cast<double>(sparse.NonZeros()));
+}
+BENCHMARK_TEMPLATE(BM_SparseTimesVector, double)->RangeMultiplier(4)->Range(1024, 65536);
+
+// The same product with matrix stored dense, that sparse one replaces
+template<typename T>
+static void BM_DenseTimesVector(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const Matrix<T> dense = RandomSparseMatrix<T>(rank).ToDense();
+	const Matrix<T> column{RandomMatrix<T>(rank, 1)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> product = dense * column;
+		KeepResult(product);
+	}
+
+	SetBytes(state, dense.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_DenseTimesVector, double)->RangeMultiplier(4)->Range(1024, 16384);
+
+template<typename T>
+static void BM_SparseTimesMatrix(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const SparseMatrix<T> sparse = RandomSparseMatrix<T>(rank);
+	const Matrix<T> right{RandomMatrix<T>(rank, 32)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> product = sparse * right;
+		KeepResult(product);
+	}
+
+	SetFlops(state, 2.0 * 32 * static_cast<double>(sparse.NonZeros()));
+}
+BENCHMARK_TEMPLATE(BM_SparseTimesMatrix, double)->RangeMultiplier(4)->Range(1024, 65536);
+
+template<typename T>
+static void BM_DenseTimesMatrix(benchmark::State &state)
+{
+	const auto rank{static_cast<std::size_t>(state.range(0))};
+	const Matrix<T> dense = RandomSparseMatrix<T>(rank).ToDense();
+	const Matrix<T> right{RandomMatrix<T>(rank, 32)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> product = dense * right;
+		KeepResult(product);
+	}
+
+	SetFlops(state, 2.0 * 32 * static_cast<double>(dense.size()));
+}
+BENCHMARK_TEMPLATE(BM_DenseTimesMatrix, double)->RangeMultiplier(4)->Range(1024, 16384);
@@ -0,0 +1,169 @@
+#include "bench_common.h"
+#include "matrixes/algorithms.h"
+#include "matrixes/matrix_batch.h"
+
+using namespace MxLib;
+
+template<typename T, std::size_t rank>
+static SMatrix<T, rank, rank> RandomStaticMatrix(unsigned seed)
+{
+	SMatrix<T, rank, rank> matrix;
+	FillRandom(matrix, seed);
+	for (std::size_t i = 0; i < rank; i++)
+	{
+		matrix(i, i) += static_cast<T>(rank);
+	}
+	return matrix;
+}
+
+template<typename T, std::size_t rank>
+static void BM_StaticDotProduct(benchmark::State &state)
+{
+	const SMatrix<T, rank, rank> lMatrix{RandomStaticMatrix<T, rank>(1)};
+	SMatrix<T, rank, rank> rMatrix{RandomStaticMatrix<T, rank>(2)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(lMatrix);
+		SMatrix<T, rank, rank> result = lMatrix * rMatrix;
+		KeepResult(result);
+	}
+
+	SetFlops(state, 2.0 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, float, 2);
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, float, 3);
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, float, 4);
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, double, 2);
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, double, 3);
+BENCHMARK_TEMPLATE(BM_StaticDotProduct, double, 4);
+
+template<typename T, std::size_t rank>
+static void BM_StaticAddition(benchmark::State &state)
+{
+	const SMatrix<T, rank, rank> lMatrix{RandomStaticMatrix<T, rank>(1)};
+	const SMatrix<T, rank, rank> rMatrix{RandomStaticMatrix<T, rank>(2)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(lMatrix);
+		SMatrix<T, rank, rank> result = lMatrix + rMatrix * T{2};
+		KeepResult(result);
+	}
+
+	SetFlops(state, 2.0 * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_StaticAddition, float, 2);
+BENCHMARK_TEMPLATE(BM_StaticAddition, float, 3);
+BENCHMARK_TEMPLATE(BM_StaticAddition, float, 4);
+BENCHMARK_TEMPLATE(BM_StaticAddition, double, 2);
+BENCHMARK_TEMPLATE(BM_StaticAddition, double, 3);
+BENCHMARK_TEMPLATE(BM_StaticAddition, double, 4);
+
+template<typename T, std::size_t rank>
+static void BM_StaticTranspose(benchmark::State &state)
+{
+	const SMatrix<T, rank, rank> matrix{RandomStaticMatrix<T, rank>(1)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(matrix);
+		SMatrix<T, rank, rank> transposed{algo::Transpose(matrix)};
+		KeepResult(transposed);
+	}
+}
+BENCHMARK_TEMPLATE(BM_StaticTranspose, float, 2);
+BENCHMARK_TEMPLATE(BM_StaticTranspose, float, 3);
+BENCHMARK_TEMPLATE(BM_StaticTranspose, float, 4);
+BENCHMARK_TEMPLATE(BM_StaticTranspose, double, 4);
+
+template<typename T, std::size_t rank>
+static void BM_StaticDeterminant(benchmark::State &state)
+{
+	const SMatrix<T, rank, rank> matrix{RandomStaticMatrix<T, rank>(1)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(matrix);
+		benchmark::DoNotOptimize(algo::Determinant(matrix));
+	}
+}
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, float, 2);
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, float, 3);
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, float, 4);
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, double, 2);
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, double, 3);
+BENCHMARK_TEMPLATE(BM_StaticDeterminant, double, 4);
+
+template<typename T, std::size_t rank>
+static void BM_StaticInverse(benchmark::State &state)
+{
+	const SMatrix<T, rank, rank> matrix{RandomStaticMatrix<T, rank>(1)};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(matrix);
+		SMatrix<T, rank, rank> inversed{algo::Inverse(matrix)};
+		KeepResult(inversed);
+	}
+}
+BENCHMARK_TEMPLATE(BM_StaticInverse, float, 2);
+BENCHMARK_TEMPLATE(BM_StaticInverse, float, 3);
+BENCHMARK_TEMPLATE(BM_StaticInverse, float, 4);
+BENCHMARK_TEMPLATE(BM_StaticInverse, double, 2);
+BENCHMARK_TEMPLATE(BM_StaticInverse, double, 3);
+BENCHMARK_TEMPLATE(BM_StaticInverse, double, 4);
+
+// Products of many small matrixes stored one after another, reference for batch below
+template<typename T, std::size_t rank>
+static void BM_StaticProductsArray(benchmark::State &state)
+{
+	const auto count{static_cast<std::size_t>(state.range(0))};
+	std::vector<SMatrix<T, rank, rank>> lMatrixes(count);
+	std::vector<SMatrix<T, rank, rank>> rMatrixes(count);
+	std::vector<SMatrix<T, rank, rank>> products(count);
+	for (std::size_t index = 0; index < count; index++)
+	{
+		lMatrixes[index] = RandomStaticMatrix<T, rank>(static_cast<unsigned>(index));
+		rMatrixes[index] = RandomStaticMatrix<T, rank>(static_cast<unsigned>(index + count));
+	}
+
+	for (auto _ : state)
+	{
+		for (std::size_t index = 0; index < count; index++)
+		{
+			products[index] = lMatrixes[index] * rMatrixes[index];
+		}
+		benchmark::DoNotOptimize(products.data());
+		benchmark::ClobberMemory();
+	}
+
+	SetFlops(state, 2.0 * rank * rank * rank * static_cast<double>(count));
+}
+BENCHMARK_TEMPLATE(BM_StaticProductsArray, float, 4)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StaticProductsArray, double, 3)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+template<typename T, std::size_t rank>
+static void BM_StaticProductsBatch(benchmark::State &state)
+{
+	const auto count{static_cast<std::size_t>(state.range(0))};
+	SMatrixBatch<T, rank, rank> lBatch{count};
+	SMatrixBatch<T, rank, rank> rBatch{count};
+	SMatrixBatch<T, rank, rank> products{count};
+	for (std::size_t index = 0; index < count; index++)
+	{
+		lBatch.Set(index, RandomStaticMatrix<T, rank>(static_cast<unsigned>(index)));
+		rBatch.Set(index, RandomStaticMatrix<T, rank>(static_cast<unsigned>(index + count)));
+	}
+
+	for (auto _ : state)
+	{
+		MultiplyInto(lBatch, rBatch, products);
+		benchmark::DoNotOptimize(products.data());
+		benchmark::ClobberMemory();
+	}
+
+	SetFlops(state, 2.0 * rank * rank * rank * static_cast<double>(count));
+}
+BENCHMARK_TEMPLATE(BM_StaticProductsBatch, float, 4)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StaticProductsBatch, double, 3)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
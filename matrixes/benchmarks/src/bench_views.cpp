@@ -0,0 +1,151 @@
+#include "bench_common.h"
+#include "matrixes/operations.h"
+#include "matrixes/view.h"
+#include "matrixes/minor.h"
+
+using namespace MxLib;
+
+// Reads every element through view accessor
+template<ReadonlyMatrixT View>
+static typename View::contained SumElements(const View &view)
+{
+	typename View::contained sum{};
+	for (std::size_t row = 0; row < view.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < view.Cols(); col++)
+		{
+			sum += view(row, col);
+		}
+	}
+	return sum;
+}
+
+template<typename T>
+static void BM_MatrixViewRead(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::size_t half = matrix.Rows() / 2;
+
+	for (auto _ : state)
+	{
+		const MatrixView view{matrix, half / 2, half / 2, half, half};
+		benchmark::DoNotOptimize(SumElements(view));
+	}
+
+	SetBytes(state, half * half * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MatrixViewRead, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_MatrixViewRead, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_MinorViewRead(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		const MinorView minor{matrix, matrix.Rows() / 2, matrix.Cols() / 2};
+		benchmark::DoNotOptimize(SumElements(minor));
+	}
+
+	SetBytes(state, matrix.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MinorViewRead, double)->RangeMultiplier(4)->Range(64, 4096);
+
+// Row is read continuously and column with stride of matrix width
+template<typename T>
+static void BM_RowColViewRead(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::size_t middle = matrix.Rows() / 2;
+
+	for (auto _ : state)
+	{
+		const RowView row{matrix, middle};
+		const ColView col{matrix, middle};
+		benchmark::DoNotOptimize(SumElements(row) + SumElements(col));
+	}
+
+	SetBytes(state, 2 * matrix.Rows() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_RowColViewRead, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_RowColViewRead, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_MatrixViewAddition(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::size_t half = matrix.Rows() / 2;
+	Matrix<T> result{half, half};
+
+	for (auto _ : state)
+	{
+		const MatrixView topLeft{matrix, 0, 0, half, half};
+		const MatrixView bottomRight{matrix, half, half, half, half};
+		result = topLeft + bottomRight;
+		KeepResult(result);
+	}
+
+	SetFlops(state, static_cast<double>(result.size()));
+	SetBytes(state, 3 * result.size() * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MatrixViewAddition, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_MatrixViewAddition, double)->RangeMultiplier(4)->Range(64, 4096);
+
+// Copy of a block of matrix into a new one
+template<typename T>
+static void BM_MatrixViewCopy(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::size_t half = matrix.Rows() / 2;
+
+	for (auto _ : state)
+	{
+		const MatrixView view{matrix, half / 2, half / 2, half, half};
+		Matrix<T> copied{view};
+		KeepResult(copied);
+	}
+
+	SetBytes(state, 2 * half * half * sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_MatrixViewCopy, float)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(BM_MatrixViewCopy, double)->RangeMultiplier(4)->Range(64, 4096);
+
+template<typename T>
+static void BM_MatrixViewProduct(benchmark::State &state)
+{
+	const Matrix<T> matrix{RandomSquareMatrix<T>(state)};
+	const std::size_t half = matrix.Rows() / 2;
+	Matrix<T> result{half, half};
+
+	for (auto _ : state)
+	{
+		const MatrixView topLeft{matrix, 0, 0, half, half};
+		const MatrixView bottomRight{matrix, half, half, half, half};
+		MultiplyInto(topLeft, bottomRight, result);
+		KeepResult(result);
+	}
+
+	const auto rank{static_cast<double>(half)};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_MatrixViewProduct, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_MatrixViewProduct, double)->RangeMultiplier(4)->Range(64, 1024);
+
+template<typename T>
+static void BM_TransposeViewProduct(benchmark::State &state)
+{
+	const Matrix<T> lMatrix{RandomSquareMatrix<T>(state)};
+	const Matrix<T> rMatrix{RandomSquareMatrix<T>(state)};
+
+	for (auto _ : state)
+	{
+		Matrix<T> result = TransposeView{lMatrix} * rMatrix;
+		KeepResult(result);
+	}
+
+	const auto rank{static_cast<double>(lMatrix.Rows())};
+	SetFlops(state, 2 * rank * rank * rank);
+}
+BENCHMARK_TEMPLATE(BM_TransposeViewProduct, float)->RangeMultiplier(4)->Range(64, 1024);
+BENCHMARK_TEMPLATE(BM_TransposeViewProduct, double)->RangeMultiplier(4)->Range(64, 1024);
@@ -1,71 +1,572 @@
 #ifndef MATRIX_ALGORITHM_H
 #define MATRIX_ALGORITHM_H
 
+#include <algorithm>
 #include <random>
 #include <utility>
 #include <stack>
 #include <functional>
+#include <limits>
+#include <vector>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
 
 #include <fmt/format.h>
 
 #include "operations.h"
 #include "minor.h"
+#include "scratch_arena.h"
+#include "static_matrixes.h"
+#include "thread_pool.h"
 
 
 namespace MxLib::algo
 {
-	template<typename ReturnT, typename InT>
-	using MapFunc = std::function<ReturnT(InT &value)>;
+	// How element-wise algorithms split their work between threads. Auto splits rows when matrix is big
+	// enough, as element-wise operations do, Parallel always splits them, which pays off for callables
+	// that are expensive per element. Callables used in parallel are called from several threads at once
+	enum class Execution
+	{
+		Auto,
+		Sequential,
+		Parallel
+	};
+
+	// Type of matrix holding results of func called on elements of M
+	template<ReadonlyMatrixT M, typename Func>
+	using MapResult = ScalarResult<M, M, std::remove_cvref_t<std::invoke_result_t<Func &, const typename M::contained &>>>;
 
-	template<ReadonlyMatrixT M, typename OutT>
-	[[nodiscard]] constexpr ScalarResult<M, M, OutT> Map(const M& matrix, const MapFunc<OutT, typename M::contained> &func)
+	namespace detail
 	{
-		ScalarResult<M, M, OutT> outMatrix{matrix};
-		for (size_t row = 0; row < outMatrix.Rows(); row++)
+		template<typename Func>
+		void ForRowsWith(Execution execution, std::size_t rows, std::size_t cols, Func &&func)
 		{
-			for (size_t col = 0; col < outMatrix.Cols(); col++)
+			switch (execution)
 			{
-				func(outMatrix(row, col));
+			case Execution::Sequential:
+				func(std::size_t{0}, rows);
+				break;
+			case Execution::Parallel:
+				parallel::SplitRows(rows, func);
+				break;
+			default:
+				parallel::ForRows(rows, cols, func);
+				break;
 			}
 		}
 
-		return outMatrix;
+		// Rows of strided storage with unit col stride are walked through pointers, so inlined
+		// callables are vectorized
+		template<typename M>
+		[[nodiscard]] constexpr inline bool HasContinuousRows(const M &matrix) noexcept
+		{
+			if constexpr (StridedStorageMatrix<M>)
+			{
+				return ColStrideOf(matrix) == 1;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		// out(row, col) = func(inputs(row, col)...) for all elements, inputs have dimensions of out
+		template<MatrixT Out, typename Func, ReadonlyMatrixT... Ms>
+		constexpr void TransformElements(Out &out, Func &func, Execution execution, const Ms &...inputs)
+		{
+			using OutT = typename Out::contained;
+
+			const std::size_t cols = out.Cols();
+			if (std::is_constant_evaluated())
+			{
+				for (std::size_t row = 0; row < out.Rows(); ++row)
+				{
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						UncheckedAt(out, row, col) = static_cast<OutT>(func(UncheckedAt(inputs, row, col)...));
+					}
+				}
+				return;
+			}
+
+			const bool continuous = HasContinuousRows(out) && (HasContinuousRows(inputs) && ...);
+			ForRowsWith(execution, out.Rows(), cols, [&](std::size_t rowStart, std::size_t rowEnd) {
+				if constexpr (StridedStorageMatrix<Out> && std::same_as<decltype(out.data()), OutT *> && (StridedStorageMatrix<Ms> && ...))
+				{
+					if (continuous)
+					{
+						for (std::size_t row = rowStart; row < rowEnd; ++row)
+						{
+							OutT *outRow = out.data() + row * RowStrideOf(out);
+							const std::tuple inRows{(inputs.data() + row * RowStrideOf(inputs))...};
+							std::apply([&](const auto *...in) {
+								for (std::size_t col = 0; col < cols; ++col)
+								{
+									outRow[col] = static_cast<OutT>(func(in[col]...));
+								}
+							}, inRows);
+						}
+						return;
+					}
+				}
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						UncheckedAt(out, row, col) = static_cast<OutT>(func(UncheckedAt(inputs, row, col)...));
+					}
+				}
+			});
+		}
+
+		template<typename M>
+		void CheckSameDimensions(const M &matrix, std::size_t rows, std::size_t cols)
+		{
+			if (matrix.Rows() != rows || matrix.Cols() != cols)
+			{
+				throw std::length_error{fmt::format("Element-wise algorithm got {}x{} matrix, but {}x{} was expected",
+					matrix.Rows(), matrix.Cols(), rows, cols)};
+			}
+		}
 	}
 
-	template<MatrixT M, typename OutT>
-	constexpr M &MapInplace(M &matrixToMap, const MapFunc<OutT, typename M::contained> &func)
+	// New matrix of func(element) for every element of matrix, func is any callable, so it is inlined
+	template<ReadonlyMatrixT M, typename Func>
+		requires std::invocable<Func &, const typename M::contained &>
+	[[nodiscard]] constexpr MapResult<M, Func> Map(const M &matrix, Func func, Execution execution = Execution::Auto)
 	{
-		for (size_t row = 0; row < matrixToMap.Rows(); row++)
+		auto mapped{MatrixConstructor<MapResult<M, Func>>::Create(matrix.Rows(), matrix.Cols())};
+		detail::TransformElements(mapped, func, execution, matrix);
+		return mapped;
+	}
+
+	// Replaces every element with func(element), callables returning nothing change elements through reference.
+	// Callables taking mutable reference and returning value get element itself and their result is stored
+	template<MatrixT M, typename Func>
+		requires std::invocable<Func &, typename M::contained &>
+	constexpr M &MapInplace(M &matrixToMap, Func func, Execution execution = Execution::Auto)
+	{
+		using T = typename M::contained;
+		using Result = std::invoke_result_t<Func &, T &>;
+
+		if constexpr (std::is_void_v<Result> || !std::invocable<Func &, const T &>)
 		{
-			for (size_t col = 0; col < matrixToMap.Cols(); col++)
+			const std::size_t cols = matrixToMap.Cols();
+			const auto mapRows = [&](std::size_t rowStart, std::size_t rowEnd) {
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						T &element = UncheckedAt(matrixToMap, row, col);
+						if constexpr (std::is_void_v<Result>)
+						{
+							func(element);
+						}
+						else
+						{
+							element = static_cast<T>(func(element));
+						}
+					}
+				}
+			};
+			if (std::is_constant_evaluated())
 			{
-				func(matrixToMap(row, col));
+				mapRows(0, matrixToMap.Rows());
 			}
+			else
+			{
+				detail::ForRowsWith(execution, matrixToMap.Rows(), cols, mapRows);
+			}
+		}
+		else
+		{
+			detail::TransformElements(matrixToMap, func, execution, matrixToMap);
 		}
+		return matrixToMap;
 	}
 
-	template<MatrixT M>
-	[[nodiscard]] constexpr TransposeResult<M> Transpose(const M &matrixToTranspose)
+	// out(row, col) = func(matrix(row, col)) into existing matrix of the same size, out may be matrix itself
+	template<ReadonlyMatrixT M, MatrixT OutM, typename Func>
+		requires std::invocable<Func &, const typename M::contained &>
+	constexpr OutM &Transform(const M &matrix, OutM &out, Func func, Execution execution = Execution::Auto)
+	{
+		detail::CheckSameDimensions(out, matrix.Rows(), matrix.Cols());
+		detail::TransformElements(out, func, execution, matrix);
+		return out;
+	}
+
+	// out(row, col) = func(lMatrix(row, col), rMatrix(row, col)) into existing matrix of the same size
+	template<ReadonlyMatrixT LM, ReadonlyMatrixT RM, MatrixT OutM, typename Func>
+		requires std::invocable<Func &, const typename LM::contained &, const typename RM::contained &>
+	constexpr OutM &Transform(const LM &lMatrix, const RM &rMatrix, OutM &out, Func func, Execution execution = Execution::Auto)
+	{
+		detail::CheckSameDimensions(rMatrix, lMatrix.Rows(), lMatrix.Cols());
+		detail::CheckSameDimensions(out, lMatrix.Rows(), lMatrix.Cols());
+		detail::TransformElements(out, func, execution, lMatrix, rMatrix);
+		return out;
+	}
+
+	namespace detail
+	{
+		// Blocks with both sides not bigger than this are transposed tile by tile, in and out
+		// blocks of double take 8 KiB each then, so they stay in L1 cache together
+		static inline constexpr const std::size_t TRANSPOSE_LEAF{32};
+
+		template<typename T>
+		void TransposeTileScalar(const T *in, std::size_t inRowStride, T *out, std::size_t outRowStride,
+			std::size_t rows, std::size_t cols) noexcept
+		{
+			for (std::size_t row = 0; row < rows; ++row)
+			{
+				for (std::size_t col = 0; col < cols; ++col)
+				{
+					out[col * outRowStride + row] = in[row * inRowStride + col];
+				}
+			}
+		}
+
+		// Cache oblivious transpose of rows x cols block of in into out, the longer side is halved
+		// until block fits into cache, so both reads and writes hit cache at every level
+		template<typename T>
+		void TransposeBlocked(const T *in, std::size_t inRowStride, T *out, std::size_t outRowStride,
+			std::size_t rows, std::size_t cols) noexcept
+		{
+			constexpr std::size_t TILE = simd::TRANSPOSE_TILE;
+
+			if (rows > TRANSPOSE_LEAF || cols > TRANSPOSE_LEAF)
+			{
+				// Split is kept at multiple of tile, so only the last blocks have partial tiles
+				if (rows >= cols)
+				{
+					const std::size_t half = (rows / 2 + TILE - 1) / TILE * TILE;
+					TransposeBlocked(in, inRowStride, out, outRowStride, half, cols);
+					TransposeBlocked(in + half * inRowStride, inRowStride, out + half, outRowStride, rows - half, cols);
+				}
+				else
+				{
+					const std::size_t half = (cols / 2 + TILE - 1) / TILE * TILE;
+					TransposeBlocked(in, inRowStride, out, outRowStride, rows, half);
+					TransposeBlocked(in + half, inRowStride, out + half * outRowStride, outRowStride, rows, cols - half);
+				}
+				return;
+			}
+
+			const std::size_t fullRows = rows / TILE * TILE;
+			const std::size_t fullCols = cols / TILE * TILE;
+			if constexpr (simd::SimdSupported<T>)
+			{
+				const auto transposeTile{simd::ActiveKernels<T>().transposeTile};
+				for (std::size_t row = 0; row < fullRows; row += TILE)
+				{
+					for (std::size_t col = 0; col < fullCols; col += TILE)
+					{
+						transposeTile(in + row * inRowStride + col, inRowStride, out + col * outRowStride + row, outRowStride);
+					}
+				}
+			}
+			else
+			{
+				for (std::size_t row = 0; row < fullRows; row += TILE)
+				{
+					for (std::size_t col = 0; col < fullCols; col += TILE)
+					{
+						TransposeTileScalar(in + row * inRowStride + col, inRowStride,
+							out + col * outRowStride + row, outRowStride, TILE, TILE);
+					}
+				}
+			}
+			TransposeTileScalar(in + fullCols, inRowStride, out + fullCols * outRowStride, outRowStride, rows, cols - fullCols);
+			TransposeTileScalar(in + fullRows * inRowStride, inRowStride, out + fullRows, outRowStride, rows - fullRows, fullCols);
+		}
+
+		// Swaps elements of square block mirrored by main diagonal, diagonal tiles are transposed
+		// in place and pairs of other tiles are exchanged through two tile buffers on stack
+		template<typename T>
+		void TransposeSquareInplace(T *data, std::size_t rowStride, std::size_t rank) noexcept
+		{
+			constexpr std::size_t TILE = simd::TRANSPOSE_TILE;
+			const std::size_t fullRank = rank / TILE * TILE;
+
+			T upper[TILE * TILE];
+			T lower[TILE * TILE];
+			for (std::size_t row = 0; row < fullRank; row += TILE)
+			{
+				for (std::size_t col = row; col < fullRank; col += TILE)
+				{
+					T *upperTile = data + row * rowStride + col;
+					T *lowerTile = data + col * rowStride + row;
+					TransposeBlocked(upperTile, rowStride, upper, TILE, TILE, TILE);
+					if (col != row)
+					{
+						TransposeBlocked(lowerTile, rowStride, lower, TILE, TILE, TILE);
+					}
+					for (std::size_t tileRow = 0; tileRow < TILE; ++tileRow)
+					{
+						std::copy_n(upper + tileRow * TILE, TILE, lowerTile + tileRow * rowStride);
+						if (col != row)
+						{
+							std::copy_n(lower + tileRow * TILE, TILE, upperTile + tileRow * rowStride);
+						}
+					}
+				}
+			}
+
+			// Rows and cols that don't fill whole tile
+			for (std::size_t row = 0; row < rank; ++row)
+			{
+				for (std::size_t col = std::max(row + 1, fullRank); col < rank; ++col)
+				{
+					std::swap(data[row * rowStride + col], data[col * rowStride + row]);
+				}
+			}
+		}
+	}
+
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] constexpr TransposeResult<EvaluatedMatrix<M>> Transpose(const M &matrixToTranspose)
 	{
-		auto transposed{MatrixConstructor<TransposeResult<M>>::Create(matrixToTranspose.Cols(), matrixToTranspose.Rows())};
+		using OutM = TransposeResult<EvaluatedMatrix<M>>;
+		if constexpr (SmallStaticMatrixT<M>)
+		{
+			return MxLib::detail::SmallTranspose(matrixToTranspose);
+		}
+
+		auto transposed{MatrixConstructor<OutM>::Create(matrixToTranspose.Cols(), matrixToTranspose.Rows())};
+		if constexpr (StridedStorageMatrix<M> && ContinuousStorageMatrix<OutM> &&
+			std::same_as<typename M::contained, typename OutM::contained> && std::is_arithmetic_v<typename M::contained>)
+		{
+			// Matrixes smaller than a tile gain nothing from blocking
+			if (!std::is_constant_evaluated() && ColStrideOf(matrixToTranspose) == 1 &&
+				(matrixToTranspose.Rows() >= simd::TRANSPOSE_TILE || matrixToTranspose.Cols() >= simd::TRANSPOSE_TILE))
+			{
+				detail::TransposeBlocked(matrixToTranspose.data(), RowStrideOf(matrixToTranspose),
+					transposed.data(), RowStrideOf(transposed), matrixToTranspose.Rows(), matrixToTranspose.Cols());
+				return transposed;
+			}
+		}
+
 		for (size_t row = 0; row < matrixToTranspose.Rows(); row++)
 		{
 			for (size_t col = 0; col < matrixToTranspose.Cols(); col++)
 			{
-				transposed(col, row) = matrixToTranspose(row, col);
+				UncheckedAt(transposed, col, row) = UncheckedAt(matrixToTranspose, row, col);
 			}
 		}
 		return transposed;
 	}
 
+	// Transposes square matrix in its own storage, nothing is allocated
+	template<MatrixT M>
+	constexpr M &TransposeInplace(M &matrixToTranspose)
+	{
+		IsSquareMatrix(matrixToTranspose);
+
+		const std::size_t rank = matrixToTranspose.Rows();
+		if constexpr (SmallSquareMatrixT<M>)
+		{
+			matrixToTranspose = MxLib::detail::SmallTranspose(matrixToTranspose);
+			return matrixToTranspose;
+		}
+		else if constexpr (ContinuousStorageMatrix<M> && std::is_arithmetic_v<typename M::contained>)
+		{
+			if (!std::is_constant_evaluated() && rank >= simd::TRANSPOSE_TILE)
+			{
+				detail::TransposeSquareInplace(matrixToTranspose.data(), RowStrideOf(matrixToTranspose), rank);
+				return matrixToTranspose;
+			}
+		}
+
+		for (std::size_t row = 0; row < rank; ++row)
+		{
+			for (std::size_t col = row + 1; col < rank; ++col)
+			{
+				std::swap(UncheckedAt(matrixToTranspose, row, col), UncheckedAt(matrixToTranspose, col, row));
+			}
+		}
+		return matrixToTranspose;
+	}
+
+	// Result of LU factorization with partial pivoting P * A = L * U
+	template<typename M>
+	struct LUDecomposition
+	{
+		// L without its unit diagonal is stored below diagonal and U on and above it
+		M lu;
+		// Row that was swapped with i-th one on i-th elimination step
+		std::vector<std::size_t> pivots;
+		// Sign of permutation P, 1 or -1
+		int permutationSign{1};
+		// Whether zero pivot was met, U has zero on its diagonal then
+		bool singular{false};
+	};
+
+	namespace detail
+	{
+		// Factorizes n x n matrix stored row by row with given stride in place, writes n pivots
+		// and returns permutation sign, or 0 if matrix is singular
+		template<std::floating_point T>
+		int LUFactorize(T *data, std::size_t n, std::size_t rowStride, std::size_t *pivots)
+		{
+			int sign = 1;
+			bool singular = false;
+			for (std::size_t step = 0; step < n; ++step)
+			{
+				std::size_t pivotRow = step;
+				T pivotAbs = std::abs(data[step * rowStride + step]);
+				for (std::size_t row = step + 1; row < n; ++row)
+				{
+					const T candidate = std::abs(data[row * rowStride + step]);
+					if (candidate > pivotAbs)
+					{
+						pivotAbs = candidate;
+						pivotRow = row;
+					}
+				}
+				pivots[step] = pivotRow;
+
+				if (pivotAbs == T{0})
+				{
+					// Column is already eliminated, nothing to divide by
+					singular = true;
+					continue;
+				}
+				if (pivotRow != step)
+				{
+					std::swap_ranges(data + step * rowStride, data + step * rowStride + n, data + pivotRow * rowStride);
+					sign = -sign;
+				}
+
+				const T *pivotLine = data + step * rowStride;
+				const T pivot = pivotLine[step];
+				const std::size_t remaining = n - step - 1;
+				parallel::ForRows(remaining, remaining, [&](std::size_t rowStart, std::size_t rowEnd) {
+					for (std::size_t row = step + 1 + rowStart; row < step + 1 + rowEnd; ++row)
+					{
+						T *line = data + row * rowStride;
+						const T factor = line[step] / pivot;
+						line[step] = factor;
+						for (std::size_t col = step + 1; col < n; ++col)
+						{
+							line[col] -= factor * pivotLine[col];
+						}
+					}
+				});
+			}
+			return singular ? 0 : sign;
+		}
+
+		[[noreturn]] inline void ThrowDeterminantOverflow()
+		{
+			throw std::overflow_error{"Integer determinant can't be computed within 64 bit integers"};
+		}
+
+		[[nodiscard]] inline std::int64_t CheckedMultiply(std::int64_t lhs, std::int64_t rhs)
+		{
+			using Limits = std::numeric_limits<std::int64_t>;
+			const bool overflows = lhs > 0 ?
+				(rhs > 0 ? lhs > Limits::max() / rhs : rhs < Limits::min() / lhs) :
+				(rhs > 0 ? lhs < Limits::min() / rhs : lhs != 0 && rhs < Limits::max() / lhs);
+			if (overflows)
+			{
+				ThrowDeterminantOverflow();
+			}
+			return lhs * rhs;
+		}
+
+		[[nodiscard]] inline std::int64_t CheckedSubtract(std::int64_t lhs, std::int64_t rhs)
+		{
+			using Limits = std::numeric_limits<std::int64_t>;
+			if ((rhs > 0 && lhs < Limits::min() + rhs) || (rhs < 0 && lhs > Limits::max() + rhs))
+			{
+				ThrowDeterminantOverflow();
+			}
+			return lhs - rhs;
+		}
+
+		// Fraction-free Bareiss elimination, every division is exact so integer result stays exact.
+		// Entries are minors of matrix, but their products are twice as wide, so steps are done in
+		// 64 bit integers and throw instead of overflowing
+		inline std::int64_t BareissDeterminant(std::int64_t *data, std::size_t n, std::size_t rowStride)
+		{
+			if (n == 0)
+			{
+				return 1;
+			}
+
+			std::int64_t sign{1};
+			std::int64_t previousPivot{1};
+			for (std::size_t step = 0; step + 1 < n; ++step)
+			{
+				if (data[step * rowStride + step] == 0)
+				{
+					std::size_t swapRow = step + 1;
+					while (swapRow < n && data[swapRow * rowStride + step] == 0)
+					{
+						++swapRow;
+					}
+					if (swapRow == n)
+					{
+						return 0;
+					}
+					std::swap_ranges(data + step * rowStride, data + step * rowStride + n, data + swapRow * rowStride);
+					sign = -sign;
+				}
+
+				const std::int64_t pivot = data[step * rowStride + step];
+				for (std::size_t row = step + 1; row < n; ++row)
+				{
+					std::int64_t *line = data + row * rowStride;
+					const std::int64_t *pivotLine = data + step * rowStride;
+					for (std::size_t col = step + 1; col < n; ++col)
+					{
+						line[col] = CheckedSubtract(CheckedMultiply(line[col], pivot),
+							CheckedMultiply(line[step], pivotLine[col])) / previousPivot;
+					}
+				}
+				previousPivot = pivot;
+			}
+			return CheckedMultiply(sign, data[(n - 1) * rowStride + n - 1]);
+		}
+	}
+
+	// LU factorization with partial pivoting of square matrix, done on a working copy
 	template<ReadonlyMatrixT M>
-	[[nodiscard]] constexpr typename M::contained Determinant(const M &matrix)
+		requires std::floating_point<typename M::contained>
+	[[nodiscard]] LUDecomposition<Matrix<typename M::contained>> LU(const M &matrix)
+	{
+		IsSquareMatrix(matrix);
+
+		LUDecomposition<Matrix<typename M::contained>> decomposition{
+			Matrix<typename M::contained>{matrix}, std::vector<std::size_t>(matrix.Rows())};
+		const int sign = detail::LUFactorize(decomposition.lu.data(), decomposition.lu.Rows(),
+			decomposition.lu.RowStride(), decomposition.pivots.data());
+		decomposition.permutationSign = sign == 0 ? 1 : sign;
+		decomposition.singular = sign == 0;
+		return decomposition;
+	}
+
+	template<typename M>
+	[[nodiscard]] typename M::contained Determinant(const LUDecomposition<M> &decomposition)
+	{
+		typename M::contained determinant = decomposition.permutationSign;
+		for (std::size_t i = 0; i < decomposition.lu.Rows(); ++i)
+		{
+			determinant *= decomposition.lu(i, i);
+		}
+		return determinant;
+	}
+
+	// Laplace expansion by the first row, the only way for types that can't be divided exactly
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] constexpr typename M::contained DeterminantByExpansion(const M &matrix)
 	{
 		using ContainedT = typename M::contained;
 		using OutMatrix = Matrix<ContainedT>;
 
-		IsSquareMatrix(matrix);
-
 		std::stack<std::pair<ContainedT, OutMatrix>> matrixesToCalculate;
 		matrixesToCalculate.emplace(1, OutMatrix{matrix});
 
@@ -91,7 +592,7 @@ namespace MxLib::algo
 				for(std::size_t i = 0; i < currentMatrixRank; i++)
 				{
 					matrixesToCalculate.emplace(
-						currentMatrix(0, i) * (i % 2 == 0 ? 1 : -1),
+						coefficient * currentMatrix(0, i) * (i % 2 == 0 ? 1 : -1),
 						MinorView(currentMatrix, 0, i)
 					);
 				}
@@ -101,39 +602,357 @@ namespace MxLib::algo
 		return determinant;
 	}
 
+	// Working copy of matrix is kept in given arena
 	template<ReadonlyMatrixT M>
-	[[nodiscard]] constexpr MultiplicationResult<M> Adjoint(const M &matrix)
+	[[nodiscard]] constexpr typename M::contained Determinant(const M &matrix, ScratchArena &arena)
+	{
+		using ContainedT = typename M::contained;
+
+		IsSquareMatrix(matrix);
+
+		if constexpr (SmallSquareMatrixT<M>)
+		{
+			return MxLib::detail::SmallDeterminant(matrix);
+		}
+		else if constexpr (std::floating_point<ContainedT>)
+		{
+			const ScratchArena::Scope scope{arena};
+			MxLib::detail::ScratchMatrix<ContainedT> working{matrix, ScratchAllocator<ContainedT>{arena}};
+			std::size_t *pivots = arena.Allocate<std::size_t>(working.Rows());
+
+			const int sign = detail::LUFactorize(working.data(), working.Rows(), working.RowStride(), pivots);
+			if (sign == 0)
+			{
+				return ContainedT{0};
+			}
+			ContainedT determinant = static_cast<ContainedT>(sign);
+			for (std::size_t i = 0; i < working.Rows(); ++i)
+			{
+				determinant *= working.Unchecked(i, i);
+			}
+			return determinant;
+		}
+		else if constexpr (std::integral<ContainedT>)
+		{
+			const ScratchArena::Scope scope{arena};
+			MxLib::detail::ScratchMatrix<std::int64_t> working{matrix, ScratchAllocator<std::int64_t>{arena}};
+			const std::int64_t determinant = detail::BareissDeterminant(working.data(), working.Rows(), working.RowStride());
+			if constexpr (std::is_signed_v<ContainedT>)
+			{
+				if (!std::in_range<ContainedT>(determinant))
+				{
+					throw std::overflow_error{fmt::format("Determinant {} exceeds range of matrix elements", determinant)};
+				}
+			}
+			return static_cast<ContainedT>(determinant);
+		}
+		else
+		{
+			return DeterminantByExpansion(matrix);
+		}
+	}
+
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] constexpr typename M::contained Determinant(const M &matrix)
+	{
+		return Determinant(matrix, ThreadScratchArena());
+	}
+
+	// Cofactors are computed in given arena, only result matrix is allocated
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] constexpr MultiplicationResult<M> Adjoint(const M &matrix, ScratchArena &arena)
 	{
 		IsSquareMatrix(matrix);
 
-		MultiplicationResult<M> outMatrix{matrix.Rows()};
-		const size_t rank = matrix.Rows();
-		for (size_t currRow = 0; currRow < rank; currRow++)
+		if constexpr (SmallSquareMatrixT<M> && std::same_as<MultiplicationResult<M>, M>)
+		{
+			M outMatrix{};
+			(void)MxLib::detail::SmallAdjugate(matrix, outMatrix);
+			return outMatrix;
+		}
+		else
 		{
-			for (size_t currCol = 0; currCol < rank; currCol++)
+			const size_t rank = matrix.Rows();
+			auto outMatrix{MatrixConstructor<MultiplicationResult<M>>::Create(rank, rank)};
+			for (size_t currRow = 0; currRow < rank; currRow++)
 			{
-				const MinorView minor{matrix, currRow, currCol};
-				// After we constructed minor calculating it's cofactor and assigning
-				// it to outMatrix
-				outMatrix(currRow, currCol) = Determinant(minor) * ((currRow + currCol) % 2 == 0 ? 1 : -1);
+				for (size_t currCol = 0; currCol < rank; currCol++)
+				{
+					const MinorView minor{matrix, currRow, currCol};
+					// Adjoint is transposed matrix of cofactors, so cofactor is placed
+					// at transposed position straight away
+					UncheckedAt(outMatrix, currCol, currRow) =
+						Determinant(minor, arena) * ((currRow + currCol) % 2 == 0 ? 1 : -1);
+				}
 			}
+
+			return outMatrix;
 		}
+	}
 
-		return Transpose(outMatrix);
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] constexpr MultiplicationResult<M> Adjoint(const M &matrix)
+	{
+		return Adjoint(matrix, ThreadScratchArena());
 	}
 	
+	namespace detail
+	{
+		// Pivot at most this is rounding noise of elimination of n x n matrix with given largest element,
+		// so scaling matrix doesn't change the answer and only numerically singular matrixes are rejected
+		template<std::floating_point T>
+		[[nodiscard]] constexpr inline T SingularPivotTolerance(std::size_t n, T largest) noexcept
+		{
+			return static_cast<T>(n) * std::numeric_limits<T>::epsilon() * largest;
+		}
+
+		// Gauss-Jordan inversion with partial pivoting of n x n matrix stored row by row,
+		// done in place with n pivots of extra memory. Returns false if matrix is singular
+		template<std::floating_point T>
+		bool GaussJordanInverse(T *data, std::size_t n, std::size_t rowStride, std::size_t *pivots)
+		{
+			T largest{0};
+			for (std::size_t row = 0; row < n; ++row)
+			{
+				for (std::size_t col = 0; col < n; ++col)
+				{
+					largest = std::max(largest, std::abs(data[row * rowStride + col]));
+				}
+			}
+			const T tolerance = SingularPivotTolerance(n, largest);
+
+			for (std::size_t step = 0; step < n; ++step)
+			{
+				std::size_t pivotRow = step;
+				for (std::size_t row = step + 1; row < n; ++row)
+				{
+					if (std::abs(data[row * rowStride + step]) > std::abs(data[pivotRow * rowStride + step]))
+					{
+						pivotRow = row;
+					}
+				}
+				pivots[step] = pivotRow;
+				if (std::abs(data[pivotRow * rowStride + step]) <= tolerance)
+				{
+					return false;
+				}
+				if (pivotRow != step)
+				{
+					std::swap_ranges(data + step * rowStride, data + step * rowStride + n, data + pivotRow * rowStride);
+				}
+
+				// Column of identity is built in place of eliminated column
+				T *pivotLine = data + step * rowStride;
+				const T inversedPivot = T{1} / pivotLine[step];
+				pivotLine[step] = T{1};
+				for (std::size_t col = 0; col < n; ++col)
+				{
+					pivotLine[col] *= inversedPivot;
+				}
+
+				parallel::ForRows(n, n, [&](std::size_t rowStart, std::size_t rowEnd) {
+					for (std::size_t row = rowStart; row < rowEnd; ++row)
+					{
+						if (row == step)
+						{
+							continue;
+						}
+						T *line = data + row * rowStride;
+						const T factor = line[step];
+						line[step] = T{0};
+						for (std::size_t col = 0; col < n; ++col)
+						{
+							line[col] -= factor * pivotLine[col];
+						}
+					}
+				});
+			}
+
+			// Row swaps of A turn into column swaps of its inverse, applied in reverse order
+			for (std::size_t step = n; step-- > 0;)
+			{
+				if (pivots[step] != step)
+				{
+					for (std::size_t row = 0; row < n; ++row)
+					{
+						std::swap(data[row * rowStride + step], data[row * rowStride + pivots[step]]);
+					}
+				}
+			}
+			return true;
+		}
+
+		// Runs partial pivoting elimination on copy of small matrix, pivots are the same ones Gauss-Jordan
+		// inversion takes, so matrixes inversed through adjugate are singular for the same tolerance
+		template<SmallSquareMatrixT M>
+		[[nodiscard]] bool HasSmallPivot(M matrix, typename M::contained tolerance) noexcept
+		{
+			constexpr std::size_t N = M::ROWS;
+			typename M::contained *data = matrix.data();
+			for (std::size_t step = 0; step < N; ++step)
+			{
+				std::size_t pivotRow = step;
+				for (std::size_t row = step + 1; row < N; ++row)
+				{
+					if (std::abs(data[row * N + step]) > std::abs(data[pivotRow * N + step]))
+					{
+						pivotRow = row;
+					}
+				}
+				if (std::abs(data[pivotRow * N + step]) <= tolerance)
+				{
+					return true;
+				}
+				if (pivotRow != step)
+				{
+					std::swap_ranges(data + step * N + step, data + step * N + N, data + pivotRow * N + step);
+				}
+				for (std::size_t row = step + 1; row < N; ++row)
+				{
+					const typename M::contained factor = data[row * N + step] / data[step * N + step];
+					for (std::size_t col = step + 1; col < N; ++col)
+					{
+						data[row * N + col] -= factor * data[step * N + col];
+					}
+				}
+			}
+			return false;
+		}
+
+		template<ReadonlyMatrixT From, MatrixT To>
+		constexpr void CopyElements(const From &from, To &to)
+		{
+			for (std::size_t row = 0; row < from.Rows(); ++row)
+			{
+				for (std::size_t col = 0; col < from.Cols(); ++col)
+				{
+					UncheckedAt(to, row, col) = static_cast<typename To::contained>(UncheckedAt(from, row, col));
+				}
+			}
+		}
+	}
+
+	// Inverses square matrix in O(n^3) without any temporary matrixes for continuous ones,
+	// pivots and working copy of other matrixes are kept in given arena
+	template<MatrixT M>
+		requires std::floating_point<typename M::contained>
+	M &InverseInplace(M &matrixToInverse, ScratchArena &arena)
+	{
+		using ContainedT = typename M::contained;
+		IsSquareMatrix(matrixToInverse);
+
+		if constexpr (SmallSquareMatrixT<M>)
+		{
+			// Pivots are compared with largest element as Gauss-Jordan inversion does, determinant
+			// alone can't tell small but well conditioned matrix from singular one
+			ContainedT *data = matrixToInverse.data();
+			ContainedT largest{0};
+			for (std::size_t pos = 0; pos < M::ROWS * M::COLS; ++pos)
+			{
+				largest = std::max(largest, std::abs(data[pos]));
+			}
+			const ContainedT tolerance = detail::SingularPivotTolerance(M::ROWS, largest);
+
+			M adjugate{};
+			const ContainedT determinant = MxLib::detail::SmallAdjugate(matrixToInverse, adjugate);
+			if (determinant == ContainedT{0} || detail::HasSmallPivot(matrixToInverse, tolerance))
+			{
+				throw std::runtime_error("Matrix is singular, no inverse can be found");
+			}
+			const ContainedT inversedDeterminant = ContainedT{1} / determinant;
+			for (std::size_t pos = 0; pos < M::ROWS * M::COLS; ++pos)
+			{
+				data[pos] = adjugate.data()[pos] * inversedDeterminant;
+			}
+			return matrixToInverse;
+		}
+
+		const ScratchArena::Scope scope{arena};
+		const std::size_t rank = matrixToInverse.Rows();
+		std::size_t *pivots = arena.Allocate<std::size_t>(rank);
+		bool inversed;
+		if constexpr (ContinuousStorageMatrix<M>)
+		{
+			inversed = detail::GaussJordanInverse(matrixToInverse.data(), rank, RowStrideOf(matrixToInverse), pivots);
+		}
+		else
+		{
+			MxLib::detail::ScratchMatrix<ContainedT> working{matrixToInverse, ScratchAllocator<ContainedT>{arena}};
+			inversed = detail::GaussJordanInverse(working.data(), rank, working.RowStride(), pivots);
+			if (inversed)
+			{
+				detail::CopyElements(working, matrixToInverse);
+			}
+		}
+
+		if (!inversed)
+		{
+			throw std::runtime_error("Matrix is singular, no inverse can be found");
+		}
+		return matrixToInverse;
+	}
+
+	template<MatrixT M>
+		requires std::floating_point<typename M::contained>
+	M &InverseInplace(M &matrixToInverse)
+	{
+		return InverseInplace(matrixToInverse, ThreadScratchArena());
+	}
+
+	// Writes inverse of matrix into outMatrix of the same size, which may be matrix itself
+	template<ReadonlyMatrixT M, MatrixT OutM>
+		requires std::floating_point<typename OutM::contained>
+	OutM &Inverse(const M &matrixToInverse, OutM &outMatrix, ScratchArena &arena)
+	{
+		IsSquareMatrix(matrixToInverse);
+		CheckDimensions(matrixToInverse, outMatrix);
+
+		if (static_cast<const void *>(&matrixToInverse) != static_cast<const void *>(&outMatrix))
+		{
+			detail::CopyElements(matrixToInverse, outMatrix);
+		}
+		return InverseInplace(outMatrix, arena);
+	}
+
+	template<ReadonlyMatrixT M, MatrixT OutM>
+		requires std::floating_point<typename OutM::contained>
+	OutM &Inverse(const M &matrixToInverse, OutM &outMatrix)
+	{
+		return Inverse(matrixToInverse, outMatrix, ThreadScratchArena());
+	}
+
 	template<ReadonlyMatrixT M>
-	[[nodiscard]] constexpr DivisionResult<MultiplicationResult<M>> Inverse(const M &matrixToInverse)
+	[[nodiscard]] DivisionResult<MultiplicationResult<M>> Inverse(const M &matrixToInverse, ScratchArena &arena)
 	{
-		using ContainedT = typename DivisionResult<MultiplicationResult<M>>::contained;
+		using ResultM = DivisionResult<MultiplicationResult<M>>;
 		IsSquareMatrix(matrixToInverse);
 
-		const ContainedT determinant = Determinant(matrixToInverse);
-		if(std::abs(determinant) <= DEFAULT_ACCURACY)
+		auto outMatrix{MatrixConstructor<ResultM>::Create(matrixToInverse.Rows(), matrixToInverse.Cols())};
+		if constexpr (std::floating_point<typename ResultM::contained>)
 		{
-			throw std::runtime_error("Matrix is triangular, no inverse can be found");
+			Inverse(matrixToInverse, outMatrix, arena);
 		}
-		return Transpose(Transpose(Adjoint(matrixToInverse)) / determinant);
+		else if constexpr (SmallSquareMatrixT<M>)
+		{
+			SMatrix<double, M::ROWS, M::COLS> working{matrixToInverse};
+			InverseInplace(working, arena);
+			detail::CopyElements(working, outMatrix);
+		}
+		else
+		{
+			// Integer matrixes are inversed in double and truncated only at the end
+			const ScratchArena::Scope scope{arena};
+			MxLib::detail::ScratchMatrix<double> working{matrixToInverse, ScratchAllocator<double>{arena}};
+			InverseInplace(working, arena);
+			detail::CopyElements(working, outMatrix);
+		}
+		return outMatrix;
+	}
+
+	template<ReadonlyMatrixT M>
+	[[nodiscard]] DivisionResult<MultiplicationResult<M>> Inverse(const M &matrixToInverse)
+	{
+		return Inverse(matrixToInverse, ThreadScratchArena());
 	}
 }
 
@@ -0,0 +1,72 @@
+#ifndef MATRIX_ALLOCATOR_H
+#define MATRIX_ALLOCATOR_H
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+
+namespace MxLib
+{
+	// Size of cache line on targeted CPUs, also the widest vector register (AVX-512) in bytes
+	static inline constexpr const std::size_t CACHE_LINE_SIZE{64};
+
+	// Allocator that places every allocation at address aligned to ALIGNMENT bytes
+	template<typename T, std::size_t ALIGNMENT = CACHE_LINE_SIZE>
+	class AlignedAllocator
+	{
+		static_assert(ALIGNMENT >= alignof(T), "Alignment cannot be less than alignment of allocated type");
+		static_assert((ALIGNMENT & (ALIGNMENT - 1)) == 0, "Alignment should be a power of 2");
+
+	public:
+		using value_type = T;
+		using is_always_equal = std::true_type;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = AlignedAllocator<U, ALIGNMENT>;
+		};
+
+		constexpr AlignedAllocator() noexcept = default;
+
+		template<typename U>
+		constexpr AlignedAllocator(const AlignedAllocator<U, ALIGNMENT> & /*unused*/) noexcept {}
+
+		[[nodiscard]] T *allocate(std::size_t count)
+		{
+			if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			{
+				throw std::bad_array_new_length{};
+			}
+			return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{ALIGNMENT}));
+		}
+
+		void deallocate(T *pointer, std::size_t /*unused*/) noexcept
+		{
+			::operator delete(pointer, std::align_val_t{ALIGNMENT});
+		}
+
+		template<typename U>
+		[[nodiscard]] constexpr bool operator==(const AlignedAllocator<U, ALIGNMENT> & /*unused*/) const noexcept
+		{
+			return true;
+		}
+	};
+
+	template<typename T>
+	using DefaultAllocator = AlignedAllocator<T>;
+
+	template<typename Allocator, typename T>
+	using ReboundAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+
+	// Layout of matrix rows in storage, padded rows start at cache line boundary,
+	// so row-wise loops never split a vector load between two lines
+	enum class RowPadding
+	{
+		None,
+		CacheLine
+	};
+}
+
+#endif // MATRIX_ALLOCATOR_H
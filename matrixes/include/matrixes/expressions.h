@@ -0,0 +1,481 @@
+#ifndef MATRIX_EXPRESSIONS_H
+#define MATRIX_EXPRESSIONS_H
+
+#include <concepts>
+#include <type_traits>
+
+#include "matrix.h"
+#include "simd.h"
+#include "thread_pool.h"
+
+namespace MxLib
+{
+	template<typename Operation, ReadonlyMatrixT LM, ReadonlyMatrixT RM>
+	class BinaryExpression;
+
+	template<typename Operation, ReadonlyMatrixT M, typename T>
+	class ScalarExpression;
+
+	// Type that expression or view turns into when it is evaluated
+	template<ReadonlyMatrixT M>
+	struct EvaluatedMatrixDeducer
+	{
+		using value = Matrix<typename M::contained>;
+	};
+
+	template<MatrixT M>
+	struct EvaluatedMatrixDeducer<M>
+	{
+		using value = M;
+	};
+
+	template<MatrixExpressionT M>
+	struct EvaluatedMatrixDeducer<M>
+	{
+		using value = typename M::evaluated;
+	};
+
+	template<ReadonlyMatrixT M>
+	using EvaluatedMatrix = typename EvaluatedMatrixDeducer<M>::value;
+
+	// Matrixes that are results of operations on themselves, other ones (expressions, views,
+	// mapped files) are results of operations only once evaluated
+	template<typename M>
+	concept SelfEvaluatedT = std::same_as<EvaluatedMatrix<M>, M>;
+
+	// Results of operations on expressions and views are deduced as for matrixes they evaluate to
+	template<ReadonlyMatrixT LMatrix, ReadonlyMatrixT RMatrix, typename ResultT>
+		requires (!SelfEvaluatedT<LMatrix>) || (!SelfEvaluatedT<RMatrix>)
+	struct OperationDeducer<LMatrix, RMatrix, ResultT>
+	{
+		using contained = ResultT;
+		using value = OperationResult<EvaluatedMatrix<LMatrix>, EvaluatedMatrix<RMatrix>, ResultT>;
+	};
+
+	template<ReadonlyMatrixT LMatrix, ReadonlyMatrixT RMatrix>
+		requires (!SelfEvaluatedT<LMatrix>) || (!SelfEvaluatedT<RMatrix>)
+	struct DotProductResultDeducer<LMatrix, RMatrix>
+	{
+		using contained = typename DotProductResultDeducer<EvaluatedMatrix<LMatrix>, EvaluatedMatrix<RMatrix>>::contained;
+		using value = DotProductResult<EvaluatedMatrix<LMatrix>, EvaluatedMatrix<RMatrix>>;
+	};
+
+	namespace detail
+	{
+		struct AddOperation
+		{
+			// Operands are converted to type of result explicitly, so mixed int and float
+			// matrixes are not converted implicitly inside of library
+			template<typename L, typename R>
+			[[nodiscard]] static constexpr inline auto Apply(const L &lhs, const R &rhs)
+			{
+				using Result = decltype(lhs + rhs);
+				return static_cast<Result>(lhs) + static_cast<Result>(rhs);
+			}
+
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ElementwiseKernel() { return simd::ActiveKernels<T>().add; }
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ScalarKernel() { return simd::ActiveKernels<T>().addScalar; }
+		};
+
+		struct SubtractOperation
+		{
+			template<typename L, typename R>
+			[[nodiscard]] static constexpr inline auto Apply(const L &lhs, const R &rhs)
+			{
+				using Result = decltype(lhs - rhs);
+				return static_cast<Result>(lhs) - static_cast<Result>(rhs);
+			}
+
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ElementwiseKernel() { return simd::ActiveKernels<T>().subtract; }
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ScalarKernel() { return simd::ActiveKernels<T>().subtractScalar; }
+		};
+
+		struct MultiplyOperation
+		{
+			template<typename L, typename R>
+			[[nodiscard]] static constexpr inline auto Apply(const L &lhs, const R &rhs)
+			{
+				using Result = decltype(lhs * rhs);
+				return static_cast<Result>(lhs) * static_cast<Result>(rhs);
+			}
+
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ElementwiseKernel() { return simd::ActiveKernels<T>().multiply; }
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ScalarKernel() { return simd::ActiveKernels<T>().multiplyScalar; }
+		};
+
+		struct DivideOperation
+		{
+			template<typename L, typename R>
+			[[nodiscard]] static constexpr inline auto Apply(const L &lhs, const R &rhs)
+			{
+				using Result = decltype(lhs / rhs);
+				return static_cast<Result>(lhs) / static_cast<Result>(rhs);
+			}
+
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ElementwiseKernel() { return simd::ActiveKernels<T>().divide; }
+			template<simd::SimdSupported T>
+			[[nodiscard]] static inline auto ScalarKernel() { return simd::ActiveKernels<T>().divideScalar; }
+		};
+
+		struct NegateOperation
+		{
+			template<typename T>
+			[[nodiscard]] static constexpr inline auto Apply(const T &value) { return -value; }
+		};
+
+		// Nested expressions are small and kept by value, matrixes are kept by reference,
+		// so expression must not outlive matrixes it was built from
+		template<ReadonlyMatrixT M>
+		using ExpressionOperand = std::conditional_t<MatrixExpressionT<M>, const M, const M &>;
+
+		// Whether element can be taken by its index in continuous row by row storage
+		template<typename M>
+		concept FlatAccessible = ContinuousStorageMatrix<M> || StridedStorageMatrix<M> ||
+			(MatrixExpressionT<M> && M::IS_CONTINUOUS);
+
+		// Whether rows of every matrix in expression follow each other without padding,
+		// flat indexes are valid only for such expressions
+		template<typename M>
+		[[nodiscard]] constexpr inline bool IsDenseStorage(const M &matrix) noexcept
+		{
+			if constexpr (requires { matrix.Left(); matrix.Right(); })
+			{
+				return IsDenseStorage(matrix.Left()) && IsDenseStorage(matrix.Right());
+			}
+			else if constexpr (requires { matrix.Operand(); })
+			{
+				return IsDenseStorage(matrix.Operand());
+			}
+			else
+			{
+				return (matrix.Rows() <= 1 || RowStrideOf(matrix) == matrix.Cols()) &&
+					(matrix.Cols() <= 1 || ColStrideOf(matrix) == 1);
+			}
+		}
+
+		template<typename M>
+		[[nodiscard]] constexpr inline auto FlatElement(const M &matrix, std::size_t index)
+		{
+			if constexpr (MatrixExpressionT<M>)
+			{
+				return matrix.Element(index);
+			}
+			else
+			{
+				return matrix.data()[index];
+			}
+		}
+
+		// Single operation over matrixes of output type can run vectorized kernels directly
+		template<typename OutT, typename... Operands>
+		concept KernelOperands = simd::SimdSupported<OutT> &&
+			((StridedStorageMatrix<Operands> && std::same_as<typename Operands::contained, OutT>) && ...);
+
+		// Kernels take rows as plain arrays, so views of columns are left to element loops
+		template<typename... Operands>
+		[[nodiscard]] inline bool CanRunKernel(const Operands &...operands) noexcept
+		{
+			return ((IsDenseStorage(operands) || (ColStrideOf(operands) == 1 && operands.Cols() > 1)) && ...);
+		}
+
+		// Continuous operand of vectorized kernel, rows start every rowStride elements
+		template<typename T>
+		struct KernelOperand
+		{
+			T *data;
+			std::size_t rowStride;
+		};
+
+		template<typename M>
+		[[nodiscard]] inline auto MakeKernelOperand(M &matrix) noexcept
+		{
+			return KernelOperand<std::remove_pointer_t<decltype(matrix.data())>>{matrix.data(), RowStrideOf(matrix)};
+		}
+
+		// Calls kernel once per chunk of rows when all operands are dense, otherwise once per row
+		template<typename Kernel, typename... Operands>
+		void RunRowsKernel(std::size_t rows, std::size_t cols, const Kernel &kernel, const Operands &...operands)
+		{
+			const bool dense = ((operands.rowStride == cols) && ...);
+			parallel::ForRows(rows, cols, [&](std::size_t rowStart, std::size_t rowEnd) {
+				if (dense)
+				{
+					kernel((operands.data + rowStart * cols)..., (rowEnd - rowStart) * cols);
+					return;
+				}
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					kernel((operands.data + row * operands.rowStride)..., cols);
+				}
+			});
+		}
+
+		template<typename T, typename LM, typename RM, typename Out>
+		void RunElementwiseKernel(void (*kernel)(const T *, const T *, T *, std::size_t) noexcept,
+			const LM &lhs, const RM &rhs, Out &out)
+		{
+			RunRowsKernel(out.Rows(), out.Cols(), kernel,
+				MakeKernelOperand(lhs), MakeKernelOperand(rhs), MakeKernelOperand(out));
+		}
+
+		template<typename T, typename M, typename Out>
+		void RunScalarKernel(void (*kernel)(const T *, T, T *, std::size_t) noexcept,
+			const M &lhs, T rhs, Out &out)
+		{
+			RunRowsKernel(out.Rows(), out.Cols(),
+				[kernel, rhs](const T *lhsRow, T *outRow, std::size_t count) { kernel(lhsRow, rhs, outRow, count); },
+				MakeKernelOperand(lhs), MakeKernelOperand(out));
+		}
+
+		template<typename E, typename Out>
+		bool TryRunKernel(const E & /*unused*/, Out & /*unused*/)
+		{
+			return false;
+		}
+
+		template<typename Operation, typename LM, typename RM, typename Out>
+		bool TryRunKernel(const BinaryExpression<Operation, LM, RM> &expression, Out &out);
+
+		template<typename Operation, typename M, typename T, typename Out>
+		bool TryRunKernel(const ScalarExpression<Operation, M, T> &expression, Out &out);
+
+		// Evaluates whole expression tree in a single pass over output
+		template<typename E, MatrixT Out>
+		constexpr void EvaluateExpression(const E &expression, Out &out)
+		{
+			using OutT = typename Out::contained;
+
+			if constexpr (ContinuousStorageMatrix<Out> && E::IS_CONTINUOUS)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					if (TryRunKernel(expression, out))
+					{
+						return;
+					}
+
+					// Flat indexes are not valid for padded rows, those take element by element path
+					if (IsDenseStorage(out) && IsDenseStorage(expression))
+					{
+						OutT *outData = out.data();
+						const std::size_t cols = out.Cols();
+						parallel::ForRows(out.Rows(), cols, [&](std::size_t rowStart, std::size_t rowEnd) {
+							for (std::size_t index = rowStart * cols; index < rowEnd * cols; ++index)
+							{
+								outData[index] = static_cast<OutT>(expression.Element(index));
+							}
+						});
+						return;
+					}
+				}
+			}
+
+			for (std::size_t row = 0; row < out.Rows(); ++row)
+			{
+				for (std::size_t col = 0; col < out.Cols(); ++col)
+				{
+					UncheckedAt(out, row, col) = static_cast<OutT>(UncheckedAt(expression, row, col));
+				}
+			}
+		}
+	}
+
+	// Lazy element-wise operation on two matrixes of the same size
+	template<typename Operation, ReadonlyMatrixT LM, ReadonlyMatrixT RM>
+	class BinaryExpression
+	{
+	public:
+		using contained = decltype(Operation::Apply(typename LM::contained{}, typename RM::contained{}));
+		using evaluated = EvaluatedMatrix<OperationResult<EvaluatedMatrix<LM>, EvaluatedMatrix<RM>, contained>>;
+
+		static constexpr const bool IS_CONTINUOUS = detail::FlatAccessible<LM> && detail::FlatAccessible<RM>;
+
+		constexpr BinaryExpression(const LM &lMatrix, const RM &rMatrix) :
+			m_lMatrix{lMatrix},
+			m_rMatrix{rMatrix}
+		{
+			CheckDimensions(lMatrix, rMatrix);
+		}
+
+		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_lMatrix.Cols(); }
+		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_lMatrix.Rows(); }
+
+		[[nodiscard]] constexpr inline contained operator()(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(m_lMatrix(row, col), m_rMatrix(row, col));
+		}
+		[[nodiscard]] constexpr inline contained Unchecked(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(UncheckedAt(m_lMatrix, row, col), UncheckedAt(m_rMatrix, row, col));
+		}
+
+		[[nodiscard]] constexpr inline contained Element(std::size_t index) const
+			requires IS_CONTINUOUS
+		{
+			return Operation::Apply(detail::FlatElement(m_lMatrix, index), detail::FlatElement(m_rMatrix, index));
+		}
+
+		template<MatrixT Out>
+		constexpr void EvaluateTo(Out &out) const
+		{
+			detail::EvaluateExpression(*this, out);
+		}
+
+		[[nodiscard]] constexpr inline const LM &Left() const noexcept { return m_lMatrix; }
+		[[nodiscard]] constexpr inline const RM &Right() const noexcept { return m_rMatrix; }
+
+	private:
+		detail::ExpressionOperand<LM> m_lMatrix;
+		detail::ExpressionOperand<RM> m_rMatrix;
+	};
+
+	// Lazy operation of every matrix element with the same scalar
+	template<typename Operation, ReadonlyMatrixT M, typename T>
+	class ScalarExpression
+	{
+	public:
+		using contained = decltype(Operation::Apply(typename M::contained{}, T{}));
+		using evaluated = EvaluatedMatrix<OperationResult<EvaluatedMatrix<M>, EvaluatedMatrix<M>, contained>>;
+
+		static constexpr const bool IS_CONTINUOUS = detail::FlatAccessible<M>;
+
+		constexpr ScalarExpression(const M &matrix, const T &scalar) :
+			m_matrix{matrix},
+			m_scalar{scalar}
+		{}
+
+		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_matrix.Cols(); }
+		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_matrix.Rows(); }
+
+		[[nodiscard]] constexpr inline contained operator()(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(m_matrix(row, col), m_scalar);
+		}
+		[[nodiscard]] constexpr inline contained Unchecked(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(UncheckedAt(m_matrix, row, col), m_scalar);
+		}
+
+		[[nodiscard]] constexpr inline contained Element(std::size_t index) const
+			requires IS_CONTINUOUS
+		{
+			return Operation::Apply(detail::FlatElement(m_matrix, index), m_scalar);
+		}
+
+		template<MatrixT Out>
+		constexpr void EvaluateTo(Out &out) const
+		{
+			detail::EvaluateExpression(*this, out);
+		}
+
+		[[nodiscard]] constexpr inline const M &Operand() const noexcept { return m_matrix; }
+		[[nodiscard]] constexpr inline const T &Scalar() const noexcept { return m_scalar; }
+
+	private:
+		detail::ExpressionOperand<M> m_matrix;
+		T m_scalar;
+	};
+
+	// Lazy operation on every matrix element
+	template<typename Operation, ReadonlyMatrixT M>
+	class UnaryExpression
+	{
+	public:
+		using contained = decltype(Operation::Apply(typename M::contained{}));
+		using evaluated = EvaluatedMatrix<OperationResult<EvaluatedMatrix<M>, EvaluatedMatrix<M>, contained>>;
+
+		static constexpr const bool IS_CONTINUOUS = detail::FlatAccessible<M>;
+
+		constexpr explicit UnaryExpression(const M &matrix) :
+			m_matrix{matrix}
+		{}
+
+		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_matrix.Cols(); }
+		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_matrix.Rows(); }
+
+		[[nodiscard]] constexpr inline contained operator()(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(m_matrix(row, col));
+		}
+		[[nodiscard]] constexpr inline contained Unchecked(std::size_t row, std::size_t col) const
+		{
+			return Operation::Apply(UncheckedAt(m_matrix, row, col));
+		}
+
+		[[nodiscard]] constexpr inline contained Element(std::size_t index) const
+			requires IS_CONTINUOUS
+		{
+			return Operation::Apply(detail::FlatElement(m_matrix, index));
+		}
+
+		template<MatrixT Out>
+		constexpr void EvaluateTo(Out &out) const
+		{
+			detail::EvaluateExpression(*this, out);
+		}
+
+		[[nodiscard]] constexpr inline const M &Operand() const noexcept { return m_matrix; }
+
+	private:
+		detail::ExpressionOperand<M> m_matrix;
+	};
+
+	namespace detail
+	{
+		template<typename Operation, typename LM, typename RM, typename Out>
+		bool TryRunKernel(const BinaryExpression<Operation, LM, RM> &expression, Out &out)
+		{
+			using OutT = typename Out::contained;
+			if constexpr (KernelOperands<OutT, Out, LM, RM> &&
+				requires { Operation::template ElementwiseKernel<OutT>(); })
+			{
+				if (!CanRunKernel(expression.Left(), expression.Right(), out))
+				{
+					return false;
+				}
+				RunElementwiseKernel(Operation::template ElementwiseKernel<OutT>(),
+					expression.Left(), expression.Right(), out);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		template<typename Operation, typename M, typename T, typename Out>
+		bool TryRunKernel(const ScalarExpression<Operation, M, T> &expression, Out &out)
+		{
+			using OutT = typename Out::contained;
+			if constexpr (KernelOperands<OutT, Out, M> &&
+				std::same_as<typename ScalarExpression<Operation, M, T>::contained, OutT> &&
+				requires { Operation::template ScalarKernel<OutT>(); })
+			{
+				if (!CanRunKernel(expression.Operand(), out))
+				{
+					return false;
+				}
+				RunScalarKernel(Operation::template ScalarKernel<OutT>(),
+					expression.Operand(), static_cast<OutT>(expression.Scalar()), out);
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+	}
+
+	static_assert(MatrixExpressionT<BinaryExpression<detail::AddOperation, MatrixD, MatrixD>>);
+	static_assert(MatrixExpressionT<ScalarExpression<detail::MultiplyOperation, MatrixF, float>>);
+	static_assert(MatrixExpressionT<UnaryExpression<detail::NegateOperation, Matrix3d>>);
+}
+
+#endif // MATRIX_EXPRESSIONS_H
@@ -0,0 +1,435 @@
+#ifndef MATRIX_GEMM_H
+#define MATRIX_GEMM_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "scratch_arena.h"
+#include "simd.h"
+#include "thread_pool.h"
+
+namespace MxLib::detail
+{
+	// Blocking parameters of packed GEMM, MR x NR is the register tile computed by
+	// micro-kernel, KC x NR panel of B is kept in L1, MC x KC block of A in L2 and
+	// KC x NC block of B in L3
+	template<typename T>
+	struct GemmBlocking
+	{
+		static constexpr std::size_t MR = 4;
+		static constexpr std::size_t NR = 4;
+		static constexpr std::size_t KC = 256;
+		static constexpr std::size_t MC = 128;
+		static constexpr std::size_t NC = 2048;
+	};
+
+	template<>
+	struct GemmBlocking<double>
+	{
+		static constexpr std::size_t MR = 6;
+		static constexpr std::size_t NR = 8;
+		static constexpr std::size_t KC = 256;
+		static constexpr std::size_t MC = 144;
+		static constexpr std::size_t NC = 4096;
+	};
+
+	template<>
+	struct GemmBlocking<float>
+	{
+		static constexpr std::size_t MR = 6;
+		static constexpr std::size_t NR = 16;
+		static constexpr std::size_t KC = 256;
+		static constexpr std::size_t MC = 144;
+		static constexpr std::size_t NC = 4096;
+	};
+
+	// Products with less multiply-add operations than this are computed directly,
+	// packing would cost more than it saves
+	static inline constexpr const std::size_t GEMM_PACKING_THRESHOLD{32 * 32 * 32};
+
+	// Read only description of strided matrix operand, element (row, col) is stored
+	// at data[row * rowStride + col * colStride]
+	template<typename T>
+	struct GemmOperand
+	{
+		const T *data;
+		std::size_t rowStride;
+		std::size_t colStride;
+
+		[[nodiscard]] constexpr inline const T &operator()(std::size_t row, std::size_t col) const noexcept
+		{
+			return data[row * rowStride + col * colStride];
+		}
+	};
+
+	// Packs mc x kc block of A scaled by alpha into row panels of MR rows, every panel is stored
+	// column by column so micro-kernel reads it sequentially. Last panel is padded with zeros
+	template<typename PackedT, typename T>
+	void PackA(const GemmOperand<T> &a, std::size_t rowStart, std::size_t colStart,
+		std::size_t mc, std::size_t kc, PackedT alpha, PackedT *packed) noexcept
+	{
+		constexpr std::size_t MR = GemmBlocking<PackedT>::MR;
+
+		for (std::size_t panel = 0; panel < mc; panel += MR)
+		{
+			const std::size_t panelRows = std::min(MR, mc - panel);
+			for (std::size_t iter = 0; iter < kc; ++iter)
+			{
+				std::size_t row = 0;
+				for (; row < panelRows; ++row)
+				{
+					*packed++ = alpha * static_cast<PackedT>(a(rowStart + panel + row, colStart + iter));
+				}
+				for (; row < MR; ++row)
+				{
+					*packed++ = PackedT{};
+				}
+			}
+		}
+	}
+
+	// Packs kc x nc block of B into column panels of NR cols, every panel is stored
+	// row by row. Last panel is padded with zeros
+	template<typename PackedT, typename T>
+	void PackB(const GemmOperand<T> &b, std::size_t rowStart, std::size_t colStart,
+		std::size_t kc, std::size_t nc, PackedT *packed) noexcept
+	{
+		constexpr std::size_t NR = GemmBlocking<PackedT>::NR;
+
+		for (std::size_t panel = 0; panel < nc; panel += NR)
+		{
+			const std::size_t panelCols = std::min(NR, nc - panel);
+			for (std::size_t iter = 0; iter < kc; ++iter)
+			{
+				std::size_t col = 0;
+				for (; col < panelCols; ++col)
+				{
+					*packed++ = static_cast<PackedT>(b(rowStart + iter, colStart + panel + col));
+				}
+				for (; col < NR; ++col)
+				{
+					*packed++ = PackedT{};
+				}
+			}
+		}
+	}
+
+	// Micro-kernel that computes MR x NR tile of packed A panel by packed B panel,
+	// floating point types use vectorized kernel for instruction set detected at startup
+	template<typename T>
+	[[nodiscard]] inline simd::MicroKernelFunc<T> ActiveMicroKernel() noexcept
+	{
+		using Blocking = GemmBlocking<T>;
+
+		if constexpr (simd::SimdSupported<T>)
+		{
+			static const simd::MicroKernelFunc<T> kernel{
+				simd::GetMicroKernel<T, Blocking::MR, Blocking::NR>(simd::ActiveIsa())};
+			return kernel;
+		}
+		else
+		{
+			return simd::scalar::MicroKernel<T, Blocking::MR, Blocking::NR>;
+		}
+	}
+
+	// Scales m x n block of C by beta, zero beta clears it without reading, so garbage in C is ignored
+	template<typename TC>
+	void ScaleOutput(std::size_t m, std::size_t n, TC beta, TC *c, std::size_t cRowStride) noexcept
+	{
+		if (beta == TC{1})
+		{
+			return;
+		}
+		for (std::size_t row = 0; row < m; ++row)
+		{
+			TC *cRow = c + row * cRowStride;
+			if (beta == TC{})
+			{
+				std::fill(cRow, cRow + n, TC{});
+				continue;
+			}
+			for (std::size_t col = 0; col < n; ++col)
+			{
+				cRow[col] *= beta;
+			}
+		}
+	}
+
+	template<typename TC, typename TA, typename TB>
+	void GemmDirect(std::size_t m, std::size_t n, std::size_t k, TC alpha,
+		const GemmOperand<TA> &a, const GemmOperand<TB> &b,
+		TC beta, TC *c, std::size_t cRowStride) noexcept
+	{
+		ScaleOutput(m, n, beta, c, cRowStride);
+		for (std::size_t row = 0; row < m; ++row)
+		{
+			TC *cRow = c + row * cRowStride;
+			for (std::size_t iter = 0; iter < k; ++iter)
+			{
+				const TC aValue = alpha * static_cast<TC>(a(row, iter));
+				for (std::size_t col = 0; col < n; ++col)
+				{
+					cRow[col] += aValue * static_cast<TC>(b(iter, col));
+				}
+			}
+		}
+	}
+
+	// Packed blocked product C = alpha * A * B + beta * C of m x k A by k x n B, runs on
+	// calling thread only, packed blocks are kept in arena of that thread
+	template<typename TC, typename TA, typename TB>
+	void GemmBlocked(std::size_t m, std::size_t n, std::size_t k, TC alpha,
+		const GemmOperand<TA> &a, const GemmOperand<TB> &b,
+		TC beta, TC *c, std::size_t cRowStride)
+	{
+		using Blocking = GemmBlocking<TC>;
+
+		const std::size_t mcMax = std::min(Blocking::MC, (m + Blocking::MR - 1) / Blocking::MR * Blocking::MR);
+		const std::size_t ncMax = std::min(Blocking::NC, (n + Blocking::NR - 1) / Blocking::NR * Blocking::NR);
+		const std::size_t kcMax = std::min(Blocking::KC, k);
+
+		ScratchArena &arena{ThreadScratchArena()};
+		const ScratchArena::Scope scope{arena};
+		TC *packedA = arena.Allocate<TC>(mcMax * kcMax);
+		TC *packedB = arena.Allocate<TC>(kcMax * ncMax);
+		const simd::MicroKernelFunc<TC> microKernel{ActiveMicroKernel<TC>()};
+
+		// Without beta first block of k overwrites C, otherwise C is scaled and every block adds to it
+		const bool accumulateOutput = beta != TC{};
+		if (accumulateOutput)
+		{
+			ScaleOutput(m, n, beta, c, cRowStride);
+		}
+
+		for (std::size_t jc = 0; jc < n; jc += Blocking::NC)
+		{
+			const std::size_t nc = std::min(Blocking::NC, n - jc);
+			for (std::size_t pc = 0; pc < k; pc += Blocking::KC)
+			{
+				const std::size_t kc = std::min(Blocking::KC, k - pc);
+				PackB(b, pc, jc, kc, nc, packedB);
+
+				for (std::size_t ic = 0; ic < m; ic += Blocking::MC)
+				{
+					const std::size_t mc = std::min(Blocking::MC, m - ic);
+					PackA(a, ic, pc, mc, kc, alpha, packedA);
+
+					for (std::size_t jr = 0; jr < nc; jr += Blocking::NR)
+					{
+						const TC *bPanel = packedB + jr * kc;
+						for (std::size_t ir = 0; ir < mc; ir += Blocking::MR)
+						{
+							microKernel(kc, packedA + ir * kc, bPanel,
+								c + (ic + ir) * cRowStride + jc + jr, cRowStride,
+								std::min(Blocking::MR, mc - ir), std::min(Blocking::NR, nc - jr),
+								accumulateOutput || pc != 0);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Splits C into grid of tiles, roughly one per thread, with aspect close to C itself,
+	// every tile is computed independently by blocked product of A rows by B cols
+	template<typename TC, typename TA, typename TB>
+	void GemmParallel(std::size_t m, std::size_t n, std::size_t k, TC alpha,
+		const GemmOperand<TA> &a, const GemmOperand<TB> &b,
+		TC beta, TC *c, std::size_t cRowStride, ThreadPool &pool)
+	{
+		using Blocking = GemmBlocking<TC>;
+
+		const std::size_t threads = pool.ThreadsCount();
+		const std::size_t rowPanels = (m + Blocking::MR - 1) / Blocking::MR;
+		const std::size_t colPanels = (n + Blocking::NR - 1) / Blocking::NR;
+
+		// rowTiles * colTiles ~ threads and rowTiles / colTiles ~ m / n
+		const auto balancedRowTiles{static_cast<std::size_t>(
+			std::lround(std::sqrt(static_cast<double>(threads) * static_cast<double>(m) / static_cast<double>(n))))};
+		const std::size_t rowTiles = std::clamp<std::size_t>(balancedRowTiles, 1, std::min(threads, rowPanels));
+		const std::size_t colTiles = std::min(colPanels, (threads + rowTiles - 1) / rowTiles);
+
+		// Tile edges are aligned to register tile, so only matrix edges have partial tiles
+		const std::size_t tileRows = (rowPanels + rowTiles - 1) / rowTiles * Blocking::MR;
+		const std::size_t tileCols = (colPanels + colTiles - 1) / colTiles * Blocking::NR;
+		const std::size_t usedRowTiles = (m + tileRows - 1) / tileRows;
+		const std::size_t usedColTiles = (n + tileCols - 1) / tileCols;
+
+		pool.ParallelFor(usedRowTiles * usedColTiles, [&](std::size_t tile) {
+			const std::size_t rowStart = tile / usedColTiles * tileRows;
+			const std::size_t colStart = tile % usedColTiles * tileCols;
+
+			GemmBlocked(std::min(tileRows, m - rowStart), std::min(tileCols, n - colStart), k, alpha,
+				GemmOperand<TA>{a.data + rowStart * a.rowStride, a.rowStride, a.colStride},
+				GemmOperand<TB>{b.data + colStart * b.colStride, b.rowStride, b.colStride},
+				beta, c + rowStart * cRowStride + colStart, cRowStride);
+		});
+	}
+
+	// y = alpha * A * x + beta * y for m x n A with continuous rows, every element of y is
+	// dot product of row of A and x. Rows are split between threads
+	template<typename T>
+	void GemvRows(std::size_t m, std::size_t n, T alpha, const GemmOperand<T> &a, const T *x,
+		T beta, T *y, std::size_t yStride)
+	{
+		parallel::ForRows(m, n, [&](std::size_t rowStart, std::size_t rowEnd) {
+			for (std::size_t row = rowStart; row < rowEnd; ++row)
+			{
+				const T *aRow = a.data + row * a.rowStride;
+				T sum{};
+				if constexpr (simd::SimdSupported<T>)
+				{
+					sum = simd::ActiveKernels<T>().dot(aRow, x, n);
+				}
+				else
+				{
+					for (std::size_t col = 0; col < n; ++col)
+					{
+						sum += aRow[col] * x[col];
+					}
+				}
+				T &out = y[row * yStride];
+				out = beta == T{} ? alpha * sum : alpha * sum + beta * out;
+			}
+		});
+	}
+
+	// y = alpha * A * x + beta * y for m x n A with continuous cols, columns of A scaled by x are
+	// added to continuous y. Threads own blocks of y, so they never write the same elements
+	template<typename T>
+	void GemvCols(std::size_t m, std::size_t n, T alpha, const GemmOperand<T> &a, const T *x,
+		std::size_t xStride, T beta, T *y)
+	{
+		parallel::ForRows(m, n, [&](std::size_t rowStart, std::size_t rowEnd) {
+			ScaleOutput(std::size_t{1}, rowEnd - rowStart, beta, y + rowStart, 0);
+			// Four cols are added at once, so y is loaded and stored four times less
+			std::size_t col = 0;
+			for (; col + 4 <= n; col += 4)
+			{
+				const T x0 = alpha * x[col * xStride];
+				const T x1 = alpha * x[(col + 1) * xStride];
+				const T x2 = alpha * x[(col + 2) * xStride];
+				const T x3 = alpha * x[(col + 3) * xStride];
+				const T *first = a.data + col * a.colStride;
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					y[row] += x0 * first[row] + x1 * first[a.colStride + row] +
+						x2 * first[2 * a.colStride + row] + x3 * first[3 * a.colStride + row];
+				}
+			}
+			for (; col < n; ++col)
+			{
+				const T coefficient = alpha * x[col * xStride];
+				const T *aCol = a.data + col * a.colStride;
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					y[row] += coefficient * aCol[row];
+				}
+			}
+		});
+	}
+
+	// Computes y = alpha * A * x + beta * y, where A is m x n, x has n elements that are xStride apart
+	// and y has m elements that are yStride apart. y is not read when beta is zero
+	template<typename T>
+	void Gemv(std::size_t m, std::size_t n, T alpha, const GemmOperand<T> &a,
+		const T *x, std::size_t xStride, T beta, T *y, std::size_t yStride)
+	{
+		if (m == 0)
+		{
+			return;
+		}
+		if (a.colStride == 1)
+		{
+			if (xStride == 1)
+			{
+				GemvRows(m, n, alpha, a, x, beta, y, yStride);
+				return;
+			}
+			// Strided x is gathered once instead of being gathered by every row
+			ScratchArena &arena{ThreadScratchArena()};
+			const ScratchArena::Scope scope{arena};
+			T *gathered = arena.Allocate<T>(n);
+			for (std::size_t col = 0; col < n; ++col)
+			{
+				gathered[col] = x[col * xStride];
+			}
+			GemvRows(m, n, alpha, a, gathered, beta, y, yStride);
+			return;
+		}
+		if (a.rowStride == 1)
+		{
+			if (yStride == 1)
+			{
+				GemvCols(m, n, alpha, a, x, xStride, beta, y);
+				return;
+			}
+			ScratchArena &arena{ThreadScratchArena()};
+			const ScratchArena::Scope scope{arena};
+			T *product = arena.Allocate<T>(m);
+			GemvCols(m, n, alpha, a, x, xStride, T{}, product);
+			for (std::size_t row = 0; row < m; ++row)
+			{
+				T &out = y[row * yStride];
+				out = beta == T{} ? product[row] : product[row] + beta * out;
+			}
+			return;
+		}
+
+		for (std::size_t row = 0; row < m; ++row)
+		{
+			T sum{};
+			for (std::size_t col = 0; col < n; ++col)
+			{
+				sum += a(row, col) * x[col * xStride];
+			}
+			T &out = y[row * yStride];
+			out = beta == T{} ? alpha * sum : alpha * sum + beta * out;
+		}
+	}
+
+	// Computes C = alpha * A * B + beta * C, where A is m x k, B is k x n and C is m x n
+	// row major matrix. C is not read when beta is zero
+	template<typename TC, typename TA, typename TB>
+	void Gemm(std::size_t m, std::size_t n, std::size_t k, TC alpha,
+		const GemmOperand<TA> &a, const GemmOperand<TB> &b,
+		TC beta, TC *c, std::size_t cRowStride)
+	{
+		if (m == 0 || n == 0)
+		{
+			return;
+		}
+		if constexpr (std::is_same_v<TA, TC> && std::is_same_v<TB, TC>)
+		{
+			// Matrix by column vector and row vector by matrix are matrix-vector products,
+			// the latter is Bᵀ * aᵀ with row of C as output
+			if (n == 1)
+			{
+				Gemv(m, k, alpha, a, b.data, b.rowStride, beta, c, cRowStride);
+				return;
+			}
+			if (m == 1)
+			{
+				Gemv(n, k, alpha, GemmOperand<TC>{b.data, b.colStride, b.rowStride}, a.data, a.colStride, beta, c, std::size_t{1});
+				return;
+			}
+		}
+		if (m * n * k <= GEMM_PACKING_THRESHOLD)
+		{
+			GemmDirect(m, n, k, alpha, a, b, beta, c, cRowStride);
+			return;
+		}
+		if (parallel::ShouldParallelize(m * n * k))
+		{
+			GemmParallel(m, n, k, alpha, a, b, beta, c, cRowStride, *parallel::DefaultThreadPool());
+			return;
+		}
+
+		GemmBlocked(m, n, k, alpha, a, b, beta, c, cRowStride);
+	}
+}
+
+#endif // MATRIX_GEMM_H
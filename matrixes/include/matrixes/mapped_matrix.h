@@ -0,0 +1,359 @@
+#ifndef MATRIX_MAPPED_MATRIX_H
+#define MATRIX_MAPPED_MATRIX_H
+
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#if !__has_include(<sys/mman.h>)
+	#error "MappedMatrix requires POSIX mmap"
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "matrix.h"
+#include "expressions.h"
+
+namespace MxLib
+{
+	enum class MapMode
+	{
+		// File is opened only for reading, elements must not be written through non-const accessors
+		ReadOnly,
+		// Written elements reach the file, at the latest when matrix is flushed or destroyed
+		ReadWrite
+	};
+
+	// Expected order of accesses to mapped elements, passed to madvise
+	enum class AccessPattern
+	{
+		Normal,
+		// Pages are read ahead aggressively and dropped soon after they were read
+		Sequential,
+		// Read ahead is disabled
+		Random,
+		// Pages are read in background before they are accessed
+		WillNeed,
+		// Pages are no longer needed and can be dropped from memory
+		DontNeed
+	};
+
+	namespace detail
+	{
+		[[noreturn, gnu::cold]] inline void ThrowSystemError(const std::filesystem::path &path, const char *action)
+		{
+			throw std::system_error{errno, std::generic_category(),
+				fmt::format("Cannot {} {}", action, path.string())};
+		}
+
+		// Closes descriptor once matrix is mapped or mapping has failed, mapping itself keeps file open
+		class FileDescriptor
+		{
+		public:
+			FileDescriptor(const std::filesystem::path &path, int flags, mode_t permissions = 0) :
+				m_descriptor{::open(path.c_str(), flags | O_CLOEXEC, permissions)}
+			{
+				if (m_descriptor < 0)
+				{
+					ThrowSystemError(path, "open");
+				}
+			}
+
+			FileDescriptor(const FileDescriptor &) = delete;
+			FileDescriptor &operator=(const FileDescriptor &) = delete;
+
+			~FileDescriptor() noexcept
+			{
+				::close(m_descriptor);
+			}
+
+			[[nodiscard]] inline int Get() const noexcept { return m_descriptor; }
+
+		private:
+			int m_descriptor;
+		};
+
+		[[nodiscard]] inline int AdviceOf(AccessPattern pattern) noexcept
+		{
+			switch (pattern)
+			{
+				case AccessPattern::Sequential: return MADV_SEQUENTIAL;
+				case AccessPattern::Random: return MADV_RANDOM;
+				case AccessPattern::WillNeed: return MADV_WILLNEED;
+				case AccessPattern::DontNeed: return MADV_DONTNEED;
+				case AccessPattern::Normal: break;
+			}
+			return MADV_NORMAL;
+		}
+	}
+
+	// Matrix stored row by row in file, that is mapped into memory instead of being read. Pages are read
+	// lazily on first access and can be dropped by OS under memory pressure, so matrix may be bigger than RAM.
+	// Elements start at offset bytes from beginning of file, so matrix can be part of bigger file
+	template<typename ContainedT>
+	class MappedMatrix
+	{
+		static_assert(std::is_trivially_copyable_v<ContainedT>, "Only trivially copyable elements can be stored in files");
+
+	public:
+		using contained = ContainedT;
+
+		MappedMatrix() noexcept = default;
+
+		MappedMatrix(const std::filesystem::path &path, std::size_t rows, std::size_t cols,
+			MapMode mode = MapMode::ReadOnly, std::size_t offset = 0) :
+			m_rows{rows},
+			m_cols{cols},
+			m_mode{mode}
+		{
+			const detail::FileDescriptor file{path, mode == MapMode::ReadOnly ? O_RDONLY : O_RDWR};
+			struct stat status{};
+			if (::fstat(file.Get(), &status) != 0)
+			{
+				detail::ThrowSystemError(path, "read size of");
+			}
+			if (static_cast<std::uintmax_t>(status.st_size) < offset + StorageBytes())
+			{
+				throw std::length_error{fmt::format("File {} of {} bytes is too small for {}x{} matrix at offset {}",
+					path.string(), status.st_size, rows, cols, offset)};
+			}
+			Map(path, file.Get(), offset);
+		}
+
+		// Creates file that holds only matrix, existing file is truncated. Elements are zero
+		[[nodiscard]] static MappedMatrix Create(const std::filesystem::path &path, std::size_t rows, std::size_t cols)
+		{
+			MappedMatrix created;
+			created.m_rows = rows;
+			created.m_cols = cols;
+			created.m_mode = MapMode::ReadWrite;
+
+			const detail::FileDescriptor file{path, O_RDWR | O_CREAT | O_TRUNC, 0644};
+			if (::ftruncate(file.Get(), static_cast<off_t>(created.StorageBytes())) != 0)
+			{
+				detail::ThrowSystemError(path, "resize");
+			}
+			created.Map(path, file.Get(), 0);
+			return created;
+		}
+
+		MappedMatrix(const MappedMatrix &) = delete;
+		MappedMatrix &operator=(const MappedMatrix &) = delete;
+
+		MappedMatrix(MappedMatrix &&matrixToMove) noexcept
+		{
+			MoveMapping(std::move(matrixToMove));
+		}
+
+		MappedMatrix &operator=(MappedMatrix &&matrixToMove) noexcept
+		{
+			if (this != &matrixToMove)
+			{
+				Unmap();
+				MoveMapping(std::move(matrixToMove));
+			}
+			return *this;
+		}
+
+		// Elements are copied into mapped pages, dimensions of mapping cannot be changed
+		template<ReadonlyMatrixT M>
+			requires std::convertible_to<typename M::contained, ContainedT>
+		MappedMatrix &operator=(const M &matrixToCopy)
+		{
+			CheckDimensions(*this, matrixToCopy);
+			CheckWritable();
+			if constexpr (StridedStorageMatrix<M>)
+			{
+				detail::CopyStrided(matrixToCopy, m_values, m_cols);
+			}
+			else
+			{
+				for (std::size_t row = 0; row < m_rows; ++row)
+				{
+					for (std::size_t col = 0; col < m_cols; ++col)
+					{
+						m_values[row * m_cols + col] = static_cast<ContainedT>(UncheckedAt(matrixToCopy, row, col));
+					}
+				}
+			}
+			return *this;
+		}
+
+		~MappedMatrix() noexcept
+		{
+			Unmap();
+		}
+
+		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_cols; }
+		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_rows; }
+		[[nodiscard]] constexpr inline std::size_t RowStride() const noexcept { return m_cols; }
+		[[nodiscard]] constexpr inline std::size_t ColStride() const noexcept { return 1; }
+		[[nodiscard]] constexpr inline MapMode Mode() const noexcept { return m_mode; }
+
+		inline const ContainedT &operator()(std::size_t row, std::size_t col) const
+		{
+			CheckBounds(*this, row, col);
+			return m_values[row * m_cols + col];
+		}
+		inline ContainedT &operator()(std::size_t row, std::size_t col)
+		{
+			CheckBounds(*this, row, col);
+			CheckWritable();
+			return m_values[row * m_cols + col];
+		}
+
+		[[nodiscard]] inline const ContainedT &Unchecked(std::size_t row, std::size_t col) const noexcept
+		{
+			return m_values[row * m_cols + col];
+		}
+		[[nodiscard]] inline ContainedT &Unchecked(std::size_t row, std::size_t col) noexcept
+		{
+			return m_values[row * m_cols + col];
+		}
+
+		[[nodiscard]] inline ContainedT *data() noexcept { return m_values; }
+		[[nodiscard]] inline const ContainedT *data() const noexcept { return m_values; }
+		[[nodiscard]] inline std::size_t size() const noexcept { return m_rows * m_cols; }
+
+		// Hint for the whole matrix, e.g. Sequential before streaming through it once
+		void Advise(AccessPattern pattern) const
+		{
+			AdviseRows(pattern, 0, m_rows);
+		}
+
+		// Hint for rows [rowBegin, rowEnd), e.g. WillNeed for rows that will be processed next
+		void AdviseRows(AccessPattern pattern, std::size_t rowBegin, std::size_t rowEnd) const
+		{
+			if (rowBegin > rowEnd || rowEnd > m_rows)
+			{
+				throw std::out_of_range{fmt::format("Rows [{}, {}) are out of mapped matrix with {} rows",
+					rowBegin, rowEnd, m_rows)};
+			}
+			if (rowBegin == rowEnd || m_mapping == nullptr)
+			{
+				return;
+			}
+			// Advised range should start at page boundary
+			const auto *mappingStart = static_cast<const std::byte *>(m_mapping);
+			const auto *begin = reinterpret_cast<const std::byte *>(m_values + rowBegin * m_cols);
+			const auto *end = reinterpret_cast<const std::byte *>(m_values + rowEnd * m_cols);
+			begin = mappingStart + static_cast<std::size_t>(begin - mappingStart) / PageSize() * PageSize();
+			if (::madvise(const_cast<std::byte *>(begin), static_cast<std::size_t>(end - begin),
+				detail::AdviceOf(pattern)) != 0)
+			{
+				throw std::system_error{errno, std::generic_category(), "Cannot advise access pattern of mapped matrix"};
+			}
+		}
+
+		// Writes changed pages to file and waits until they are written
+		void Flush() const
+		{
+			if (m_mode == MapMode::ReadWrite && m_mapping != nullptr &&
+				::msync(m_mapping, m_mappingSize, MS_SYNC) != 0)
+			{
+				throw std::system_error{errno, std::generic_category(), "Cannot flush mapped matrix"};
+			}
+		}
+
+	private:
+		[[nodiscard]] static inline std::size_t PageSize() noexcept
+		{
+			static const std::size_t pageSize{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+			return pageSize;
+		}
+
+		[[nodiscard]] inline std::size_t StorageBytes() const noexcept
+		{
+			return m_rows * m_cols * sizeof(ContainedT);
+		}
+
+		// Mapping starts at page boundary, so offset is split into whole pages and shift inside of page
+		void Map(const std::filesystem::path &path, int descriptor, std::size_t offset)
+		{
+			if (offset % alignof(ContainedT) != 0)
+			{
+				throw std::invalid_argument{fmt::format("Offset {} is not aligned for elements of {} bytes",
+					offset, alignof(ContainedT))};
+			}
+			if (StorageBytes() == 0)
+			{
+				return;
+			}
+
+			const std::size_t pageOffset = offset / PageSize() * PageSize();
+			const std::size_t shift = offset - pageOffset;
+			const int protection = m_mode == MapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+			void *mapping = ::mmap(nullptr, shift + StorageBytes(), protection, MAP_SHARED, descriptor,
+				static_cast<off_t>(pageOffset));
+			if (mapping == MAP_FAILED)
+			{
+				detail::ThrowSystemError(path, "map");
+			}
+			m_mapping = mapping;
+			m_mappingSize = shift + StorageBytes();
+			m_values = reinterpret_cast<ContainedT *>(static_cast<std::byte *>(mapping) + shift);
+		}
+
+		void Unmap() noexcept
+		{
+			if (m_mapping != nullptr)
+			{
+				::munmap(m_mapping, m_mappingSize);
+				m_mapping = nullptr;
+				m_values = nullptr;
+			}
+		}
+
+		void MoveMapping(MappedMatrix &&matrixToMove) noexcept
+		{
+			m_rows = std::exchange(matrixToMove.m_rows, 0);
+			m_cols = std::exchange(matrixToMove.m_cols, 0);
+			m_mode = matrixToMove.m_mode;
+			m_mapping = std::exchange(matrixToMove.m_mapping, nullptr);
+			m_mappingSize = std::exchange(matrixToMove.m_mappingSize, 0);
+			m_values = std::exchange(matrixToMove.m_values, nullptr);
+		}
+
+		// Writes to pages mapped for reading only crash the process, so they are caught while checks are on
+		inline void CheckWritable() const
+		{
+#if MATHX_BOUNDS_CHECK
+			if (m_mode == MapMode::ReadOnly)
+			{
+				throw std::logic_error{"Mapped matrix is opened for reading only, it should be accessed through const reference"};
+			}
+#endif
+		}
+
+		std::size_t m_rows{0};
+		std::size_t m_cols{0};
+		MapMode m_mode{MapMode::ReadOnly};
+
+		void *m_mapping{nullptr};
+		std::size_t m_mappingSize{0};
+		ContainedT *m_values{nullptr};
+	};
+
+	// Operations on mapped matrixes produce matrixes in memory
+	template<typename ContainedT>
+	struct EvaluatedMatrixDeducer<MappedMatrix<ContainedT>>
+	{
+		using value = Matrix<ContainedT>;
+	};
+
+	static_assert(ContinuousStorageMatrix<MappedMatrix<float>>, "Mapped matrix doesn't follow the ContinuousStorageMatrix concept");
+	static_assert(StridedStorageMatrix<MappedMatrix<float>>, "Mapped matrix doesn't follow the StridedStorageMatrix concept");
+}
+
+#endif // MATRIX_MAPPED_MATRIX_H
@@ -1,30 +1,39 @@
 #ifndef MATRIX_H
 #define MATRIX_H
 
+#include <algorithm>
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
 #include <array>
 
 #include <fmt/format.h>
 
+#include "allocator.h"
 #include "matrix_concepts.h"
 #include "operations_deduction.h"
 
 namespace MxLib
 {
-	template<typename ContainedT>
+	template<typename ContainedT, typename Allocator = DefaultAllocator<ContainedT>>
 	class Matrix
 	{
+		using AllocatorTraits = std::allocator_traits<Allocator>;
+
 	public:
 		using contained = ContainedT;
+		using allocator_type = Allocator;
+
+		Matrix() noexcept(noexcept(Allocator{})) = default;
 
-		Matrix() noexcept = default;
+		explicit Matrix(const Allocator &allocator) noexcept :
+			m_allocator{allocator}
+		{}
 
-		Matrix(const std::initializer_list<std::initializer_list<ContainedT>> &initializer) :
-			m_cols{initializer.size() > 0 ? initializer.begin()[0].size() : 0},
-			m_rows{initializer.size()},
-			m_size{m_rows * m_cols},
-			m_values{m_size > 0 ? new ContainedT[m_size] : nullptr}
+		Matrix(const std::initializer_list<std::initializer_list<ContainedT>> &initializer,
+			const Allocator &allocator = Allocator{}) :
+			Matrix{initializer.size(), initializer.size() > 0 ? initializer.begin()[0].size() : 0,
+				RowPadding::None, allocator}
 		{
 			for(std::size_t rowIndex = 0; rowIndex < m_rows; rowIndex++)
 			{
@@ -35,51 +44,70 @@ namespace MxLib
 
 				for (std::size_t colIndex = 0; colIndex < m_cols; colIndex++)
 				{
-					(*this)(rowIndex, colIndex) = initializer.begin()[rowIndex].begin()[colIndex];
+					m_values[CalculatePos(rowIndex, colIndex)] = initializer.begin()[rowIndex].begin()[colIndex];
 				}
 			}
 		}
-		Matrix(std::size_t rows, std::size_t cols) :
+		Matrix(std::size_t rows, std::size_t cols, RowPadding padding = RowPadding::None,
+			const Allocator &allocator = Allocator{}) :
 			m_cols{cols},
 			m_rows{rows},
+			m_rowStride{CalculateRowStride(cols, padding)},
 			m_size{rows * cols},
-			m_values{new ContainedT[rows * cols]}
+			m_allocator{allocator}
 		{
+			Allocate();
 		}
+		Matrix(std::size_t rows, std::size_t cols, const Allocator &allocator) :
+			Matrix{rows, cols, RowPadding::None, allocator}
+		{}
 
 		explicit Matrix(std::size_t dimensions) :
-			m_cols{dimensions},
-			m_rows{dimensions},
-			m_size{dimensions * dimensions},
-			m_values{new ContainedT[m_size]}
+			Matrix{dimensions, dimensions}
 		{}
 
 		template<ReadonlyMatrixT M>
 			requires std::convertible_to<typename M::contained, ContainedT>
 		explicit Matrix(const M &matrixToCopy) :
-			m_cols{matrixToCopy.Cols()},
-			m_rows{matrixToCopy.Rows()},
-			m_size{m_cols * m_rows},
-			m_values{m_size > 0 ? new ContainedT[m_size] : nullptr}
+			Matrix{matrixToCopy, Allocator{}}
+		{}
+
+		template<ReadonlyMatrixT M>
+			requires std::convertible_to<typename M::contained, ContainedT>
+		Matrix(const M &matrixToCopy, const Allocator &allocator) :
+			Matrix{matrixToCopy.Rows(), matrixToCopy.Cols(), RowPadding::None, allocator}
 		{
-			for (std::size_t row = 0; row < m_rows; ++row)
-			{
-				for (std::size_t col = 0; col < m_cols; ++col)
-				{
-					(*this)(row, col) = static_cast<ContainedT>(matrixToCopy(row, col));
-				}
-			}
+			CopyElements(matrixToCopy);
+		}
+
+		// Expressions are evaluated straight into new matrix storage
+		template<MatrixExpressionT E>
+			requires std::convertible_to<typename E::contained, ContainedT>
+		Matrix(const E &expression) :
+			Matrix{expression.Rows(), expression.Cols()}
+		{
+			expression.EvaluateTo(*this);
 		}
 
 		template<ReadonlyMatrixT M>
 			requires std::convertible_to<typename M::contained, ContainedT>
 		Matrix &operator=(const M &matrixToCopy)
 		{
-			if(this != &matrixToCopy)
+			// Source may view this matrix, so it is read before storage is replaced. Sources reading
+			// this matrix at other positions, like its transpose, are read into temporary as well
+			if (m_rows != matrixToCopy.Rows() || m_cols != matrixToCopy.Cols() ||
+				detail::ReadsOtherPositions(matrixToCopy, *this))
 			{
-				delete[] m_values;
-
-				CopyData(matrixToCopy);
+				Matrix copied{matrixToCopy, m_allocator};
+				MoveData(std::move(copied));
+			}
+			else if constexpr (MatrixExpressionT<M>)
+			{
+				matrixToCopy.EvaluateTo(*this);
+			}
+			else
+			{
+				CopyElements(matrixToCopy);
 			}
 
 			return *this;
@@ -91,10 +119,9 @@ namespace MxLib
 		{
 			for(std::size_t row = 0; row < rows; ++row)
 			{
-				for(std::size_t col = 0; col < rows; ++col)
+				for(std::size_t col = 0; col < cols; ++col)
 				{
-					const std::size_t pos = CalculatePos(row, col); 
-					m_values[pos] = data[pos];
+					m_values[CalculatePos(row, col)] = data[row * cols + col];
 				}
 			}
 		}
@@ -104,15 +131,15 @@ namespace MxLib
 		{
 			for(std::size_t row = 0; row < rows; ++row)
 			{
-				for(std::size_t col = 0; col < rows; ++col)
+				for(std::size_t col = 0; col < cols; ++col)
 				{
-					const std::size_t pos = CalculatePos(row, col); 
-					m_values[pos] = data[row][col];
+					m_values[CalculatePos(row, col)] = data[row][col];
 				}
 			}
 		}
 
-		Matrix(const Matrix &matrixToCopy)
+		Matrix(const Matrix &matrixToCopy) :
+			m_allocator{AllocatorTraits::select_on_container_copy_construction(matrixToCopy.m_allocator)}
 		{
 			CopyData(matrixToCopy);
 		}
@@ -121,7 +148,11 @@ namespace MxLib
 		{
 			if(this != &matrixToCopy)
 			{
-				delete[] m_values;
+				Deallocate();
+				if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+				{
+					m_allocator = matrixToCopy.m_allocator;
+				}
 
 				CopyData(matrixToCopy);
 			}
@@ -129,28 +160,48 @@ namespace MxLib
 			return *this;
 		}
 
-		Matrix(Matrix &&matrixToMove) noexcept
+		Matrix(Matrix &&matrixToMove) noexcept :
+			m_allocator{std::move(matrixToMove.m_allocator)}
 		{
 			MoveData(std::move(matrixToMove));
 		}
 
-		Matrix &operator=(Matrix &&matrixToMove) noexcept
+		Matrix &operator=(Matrix &&matrixToMove)
+			noexcept(AllocatorTraits::propagate_on_container_move_assignment::value ||
+				AllocatorTraits::is_always_equal::value)
 		{
-			if (this != &matrixToMove)
+			if (this == &matrixToMove)
 			{
-				MoveData(std::move(matrixToMove));
+				return *this;
 			}
+
+			if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+			{
+				Deallocate();
+				m_allocator = std::move(matrixToMove.m_allocator);
+			}
+			else if (!AllocatorTraits::is_always_equal::value && m_allocator != matrixToMove.m_allocator)
+			{
+				// Storage of other allocator cannot be released by ours, so elements are copied
+				Deallocate();
+				CopyData(matrixToMove);
+				return *this;
+			}
+			MoveData(std::move(matrixToMove));
 			return *this;
 		}
 
 		~Matrix() noexcept
 		{
-			delete[](m_values);
+			Deallocate();
 		}
 
 		// Getters and setters
 		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_cols; }
 		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_rows; }
+		// Distance between starts of neighbouring rows in elements, bigger than Cols() for padded rows
+		[[nodiscard]] constexpr inline std::size_t RowStride() const noexcept { return m_rowStride; }
+		[[nodiscard]] constexpr inline std::size_t ColStride() const noexcept { return 1; }
 
 		constexpr inline const ContainedT &operator()(std::size_t row, std::size_t col) const
 		{
@@ -163,76 +214,164 @@ namespace MxLib
 			return m_values[CalculatePos(row, col)];
 		}
 
+		// Accessors without bounds check, for loops that keep indexes in bounds themselves
+		[[nodiscard]] constexpr inline const ContainedT &Unchecked(std::size_t row, std::size_t col) const noexcept
+		{
+			return m_values[CalculatePos(row, col)];
+		}
+		[[nodiscard]] constexpr inline ContainedT &Unchecked(std::size_t row, std::size_t col) noexcept
+		{
+			return m_values[CalculatePos(row, col)];
+		}
+
 		[[nodiscard]] constexpr inline ContainedT *data() { return m_values; }
 		[[nodiscard]] constexpr inline const ContainedT *data() const { return m_values; }
 		[[nodiscard]] constexpr inline std::size_t size() const { return m_size; }
+		[[nodiscard]] constexpr inline Allocator get_allocator() const { return m_allocator; }
 
 		static Matrix Identity(std::size_t rank)
 		{
 			Matrix identityMatrix{rank};
+			std::fill(identityMatrix.m_values, identityMatrix.m_values + identityMatrix.m_size, ContainedT{});
 			for ( std::size_t i = 0; i < rank; ++i)
 			{
-				identityMatrix(i, i) = 1;
+				identityMatrix.Unchecked(i, i) = 1;
 			}
 			return identityMatrix;
 		}
 
 	private:
+		[[nodiscard]] static constexpr std::size_t CalculateRowStride(std::size_t cols, RowPadding padding) noexcept
+		{
+			constexpr std::size_t LINE_ELEMENTS = CACHE_LINE_SIZE / sizeof(ContainedT);
+			if (padding == RowPadding::None || CACHE_LINE_SIZE % sizeof(ContainedT) != 0)
+			{
+				return cols;
+			}
+			return (cols + LINE_ELEMENTS - 1) / LINE_ELEMENTS * LINE_ELEMENTS;
+		}
+
+		// Elements are default initialized like with new[], so arithmetic types stay uninitialized
+		void Allocate()
+		{
+			const std::size_t storageSize = StorageSize();
+			if (storageSize == 0)
+			{
+				return;
+			}
+
+			m_values = AllocatorTraits::allocate(m_allocator, storageSize);
+			try
+			{
+				std::uninitialized_default_construct_n(m_values, storageSize);
+			}
+			catch (...)
+			{
+				AllocatorTraits::deallocate(m_allocator, m_values, storageSize);
+				m_values = nullptr;
+				throw;
+			}
+		}
+
+		void Deallocate() noexcept
+		{
+			if (m_values != nullptr)
+			{
+				std::destroy_n(m_values, StorageSize());
+				AllocatorTraits::deallocate(m_allocator, m_values, StorageSize());
+				m_values = nullptr;
+			}
+		}
+
 		void MoveData(Matrix &&matrixToMove) noexcept
 		{
-			delete[] m_values;
+			Deallocate();
 
 			m_rows = matrixToMove.m_rows;
 			m_cols = matrixToMove.m_cols;
+			m_rowStride = matrixToMove.m_rowStride;
 			m_size = matrixToMove.m_size;
 
 			m_values = matrixToMove.m_values;
 
 			matrixToMove.m_values = nullptr;
-			matrixToMove.m_rows = matrixToMove.m_cols = matrixToMove.m_size = 0;
+			matrixToMove.m_rows = matrixToMove.m_cols = matrixToMove.m_rowStride = matrixToMove.m_size = 0;
 		}
 
+		// Matrixes with strided storage are copied row by row through pointers
 		template<ReadonlyMatrixT M>
-			requires std::convertible_to<typename M::contained, ContainedT>
-		void CopyData(const M& matrixToCopy)
+		void CopyElements(const M &matrixToCopy)
+		{
+			if constexpr (StridedStorageMatrix<M>)
+			{
+				detail::CopyStrided(matrixToCopy, m_values, m_rowStride);
+			}
+			else
+			{
+				for (std::size_t row = 0; row < m_rows; ++row)
+				{
+					for (std::size_t col = 0; col < m_cols; ++col)
+					{
+						m_values[CalculatePos(row, col)] = static_cast<ContainedT>(UncheckedAt(matrixToCopy, row, col));
+					}
+				}
+			}
+		}
+
+		// Copy keeps row padding of copied matrix
+		void CopyData(const Matrix &matrixToCopy)
 		{
 			m_cols = matrixToCopy.m_cols;
 			m_rows = matrixToCopy.m_rows;
+			m_rowStride = matrixToCopy.m_rowStride;
 			m_size = matrixToCopy.m_size;
 
-			m_values = new ContainedT[m_size];
+			Allocate();
 
-			for(size_t index = 0; index < m_size; index++)
+			for(std::size_t row = 0; row < m_rows; row++)
 			{
-				m_values[index] = static_cast<ContainedT>(matrixToCopy.m_values[index]);
+				const ContainedT *rowToCopy = matrixToCopy.m_values + row * m_rowStride;
+				std::copy(rowToCopy, rowToCopy + m_cols, m_values + row * m_rowStride);
 			}
 		}
 
+		[[nodiscard]] constexpr inline std::size_t StorageSize() const noexcept
+		{
+			return m_rows * m_rowStride;
+		}
+
 		[[nodiscard]] constexpr inline std::size_t CalculatePos(std::size_t row, std::size_t col) const noexcept
 		{
-			return row * m_cols + col;
+			return row * m_rowStride + col;
 		}
 
 		std::size_t m_cols{ 0 };
 		std::size_t m_rows{ 0 };
+		std::size_t m_rowStride{ 0 };
 		std::size_t m_size{ 0 };
 
 		ContainedT *m_values{ nullptr };
+		[[no_unique_address]] Allocator m_allocator;
 	};
 
 	using MatrixF = Matrix<float>;
 	using MatrixD = Matrix<double>;
 
-	template<typename LContainedT, typename RContainedT, typename ResultT>
-	struct OperationDeducer<Matrix<LContainedT>, Matrix<RContainedT>, ResultT>
+	// Results of operations on matrixes are allocated the same way as left operand
+	template<typename LContainedT, typename LAllocator, typename RContainedT, typename RAllocator, typename ResultT>
+	struct OperationDeducer<Matrix<LContainedT, LAllocator>, Matrix<RContainedT, RAllocator>, ResultT>
 	{
 		using contained = ResultT;
-		using value = Matrix<ResultT>;
+		using value = Matrix<ResultT, ReboundAllocator<LAllocator, ResultT>>;
 	};
 
+	template<MatrixExpressionT E>
+	Matrix(const E &expression) -> Matrix<typename E::contained>;
+
 	static_assert(ReadonlyMatrixT<Matrix<float>>, "Basic matrix type doesn't follow the MatrixT concept");
 	static_assert(MatrixT<Matrix<float>>, "Basic matrix type doesn't follow the MatrixT concept");
 	static_assert(ContinuousStorageMatrix<Matrix<float>>, "Basic matrix type doesn't follow the ContinuousStorageMatrix concept");
+	static_assert(StridedStorageMatrix<Matrix<float>>, "Basic matrix type doesn't follow the StridedStorageMatrix concept");
 
 	static_assert(ContinuousStorageMatrix<OperationDeducer<Matrix<float>, Matrix<float>, float>::value>, "Basic matrix type doesn't follow the MatrixT concept");
 
@@ -242,7 +381,7 @@ namespace MxLib
 	public:
 		using contained = ContainedT;
 		const constexpr static std::size_t ROWS = rows;
-		const constexpr static std::size_t COLS = rows;
+		const constexpr static std::size_t COLS = cols;
 
 		constexpr SMatrix() = default;
 		constexpr ~SMatrix() = default;
@@ -277,20 +416,45 @@ namespace MxLib
 		explicit SMatrix(const M &matrixToCopy)
 		{
 			CheckDimensions(*this, matrixToCopy);
-			for (std::size_t row = 0; row < rows; ++row)
+			CopyElements(matrixToCopy);
+		}
+
+		template<MatrixExpressionT E>
+			requires std::convertible_to<typename E::contained, ContainedT>
+		constexpr SMatrix(const E &expression)
+		{
+			CheckDimensions(*this, expression);
+			expression.EvaluateTo(*this);
+		}
+
+		template<ReadonlyMatrixT M>
+			requires std::convertible_to<typename M::contained, ContainedT>
+		constexpr SMatrix &operator=(const M &matrixToCopy)
+		{
+			CheckDimensions(*this, matrixToCopy);
+			// Sources reading this matrix at other positions, like its transpose, are read into temporary
+			// first. Views aren't constructed while constant evaluated, so expressions are written in place
+			if (!std::is_constant_evaluated() && detail::ReadsOtherPositions(matrixToCopy, *this))
 			{
-				for (std::size_t col = 0; col < cols; ++col)
-				{
-					m_values[CalculatePos(row, col)] = matrixToCopy(row, col);
-				}
+				const SMatrix copied{matrixToCopy};
+				m_values = copied.m_values;
 			}
+			else if constexpr (MatrixExpressionT<M>)
+			{
+				matrixToCopy.EvaluateTo(*this);
+			}
+			else
+			{
+				CopyElements(matrixToCopy);
+			}
+			return *this;
 		}
 
 		constexpr explicit SMatrix(const ContainedT *data)
 		{
 			for(std::size_t row = 0; row < rows; ++row)
 			{
-				for(std::size_t col = 0; col < rows; ++col)
+				for(std::size_t col = 0; col < cols; ++col)
 				{
 					const std::size_t pos = CalculatePos(row, col); 
 					m_values[pos] = data[pos];
@@ -302,7 +466,7 @@ namespace MxLib
 		{
 			for(std::size_t row = 0; row < rows; ++row)
 			{
-				for(std::size_t col = 0; col < rows; ++col)
+				for(std::size_t col = 0; col < cols; ++col)
 				{
 					const std::size_t pos = CalculatePos(row, col); 
 					m_values[pos] = data[row][col];
@@ -312,14 +476,16 @@ namespace MxLib
 
 		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return cols; }
 		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return rows; }
+		[[nodiscard]] constexpr inline std::size_t RowStride() const noexcept { return cols; }
+		[[nodiscard]] constexpr inline std::size_t ColStride() const noexcept { return 1; }
 
 		[[nodiscard]] constexpr inline ContainedT *data()
 		{
-			return m_values;
+			return m_values.data();
 		}
 		[[nodiscard]] constexpr inline const ContainedT *data() const
 		{
-			return m_values;
+			return m_values.data();
 		}
 
 		[[nodiscard]] constexpr inline std::size_t size() const
@@ -338,6 +504,16 @@ namespace MxLib
 			CheckBounds(*this, row, col);
 			return m_values[CalculatePos(row, col)];
 		}
+
+		// Accessors without bounds check, for loops that keep indexes in bounds themselves
+		[[nodiscard]] constexpr inline const ContainedT &Unchecked(std::size_t row, std::size_t col) const noexcept
+		{
+			return m_values[CalculatePos(row, col)];
+		}
+		[[nodiscard]] constexpr inline ContainedT &Unchecked(std::size_t row, std::size_t col) noexcept
+		{
+			return m_values[CalculatePos(row, col)];
+		}
 	
 	private:
 		[[nodiscard]] constexpr static inline std::size_t CalculatePos(std::size_t row, std::size_t col) noexcept
@@ -345,10 +521,34 @@ namespace MxLib
 			return row * cols + col;
 		}
 
+		template<ReadonlyMatrixT M>
+		constexpr void CopyElements(const M &matrixToCopy)
+		{
+			if constexpr (StridedStorageMatrix<M>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					detail::CopyStrided(matrixToCopy, m_values.data(), cols);
+					return;
+				}
+			}
+			for (std::size_t row = 0; row < rows; ++row)
+			{
+				for (std::size_t col = 0; col < cols; ++col)
+				{
+					m_values[CalculatePos(row, col)] = static_cast<ContainedT>(UncheckedAt(matrixToCopy, row, col));
+				}
+			}
+		}
+
 	private:
 		std::array<ContainedT, rows * cols> m_values;
 	};
 
+	template<MatrixExpressionT E>
+		requires StaticMatrixT<typename E::evaluated>
+	SMatrix(const E &expression) -> SMatrix<typename E::contained, E::evaluated::ROWS, E::evaluated::COLS>;
+
 	using Matrix2f = SMatrix<float, 2, 2>;
 	using Matrix3f = SMatrix<float, 3, 3>;
 	using Matrix4f = SMatrix<float, 4, 4>;
@@ -370,6 +570,9 @@ namespace MxLib
 	static_assert(ContinuousStorageMatrix<Matrix4f>);
 	static_assert(ContinuousStorageMatrix<Matrix4d>);
 
+	static_assert(StridedStorageMatrix<Matrix3f>);
+	static_assert(StridedStorageMatrix<Matrix4d>);
+
 	template<typename ContainedLT, std::size_t lRows, std::size_t lCols,
 		typename ContainedRT, std::size_t rRows, std::size_t rCols,
 		typename ResultT>
@@ -381,19 +584,19 @@ namespace MxLib
 		using value = SMatrix<ResultT, lRows, lCols>;
 	};
 
-	template<typename ContainedLT,
+	template<typename ContainedLT, typename LAllocator,
 		typename ContainedRT, std::size_t rRows, std::size_t rCols,
 		typename ResultT>
-	struct OperationDeducer<Matrix<ContainedLT>, SMatrix<ContainedRT, rRows, rCols>, ResultT>
+	struct OperationDeducer<Matrix<ContainedLT, LAllocator>, SMatrix<ContainedRT, rRows, rCols>, ResultT>
 	{
-		using value = Matrix<ResultT>;
+		using value = Matrix<ResultT, ReboundAllocator<LAllocator, ResultT>>;
 	};
 
 	template<typename ContainedLT, std::size_t lRows, std::size_t lCols,
-		typename ContainedRT, typename ResultT>
-	struct OperationDeducer<SMatrix<ContainedLT, lRows, lCols>, Matrix<ContainedRT>, ResultT>
+		typename ContainedRT, typename RAllocator, typename ResultT>
+	struct OperationDeducer<SMatrix<ContainedLT, lRows, lCols>, Matrix<ContainedRT, RAllocator>, ResultT>
 	{
-		using value = Matrix<ResultT>;
+		using value = Matrix<ResultT, ReboundAllocator<RAllocator, ResultT>>;
 	};
 
 	template<std::size_t LRows, std::size_t LCols, typename LContainedT,
@@ -406,19 +609,20 @@ namespace MxLib
 		using value = SMatrix<contained, LRows, RCols>;
 	};
 
-	template<typename LContainedT,
+	template<typename LContainedT, typename LAllocator,
 		std::size_t RRows, std::size_t RCols, typename RContainedT>
-	struct DotProductResultDeducer<Matrix<LContainedT>, SMatrix<RContainedT, RRows, RCols>>
+	struct DotProductResultDeducer<Matrix<LContainedT, LAllocator>, SMatrix<RContainedT, RRows, RCols>>
 	{
 		using contained = decltype(LContainedT{} * RContainedT{} + LContainedT{} * RContainedT{});
-		using value = Matrix<contained>;
+		using value = Matrix<contained, ReboundAllocator<LAllocator, contained>>;
 	};
 
-	template<std::size_t LRows, std::size_t LCols, typename LContainedT, typename RContainedT>
-	struct DotProductResultDeducer<SMatrix<LContainedT, LRows, LCols>, Matrix<RContainedT>>
+	template<std::size_t LRows, std::size_t LCols, typename LContainedT,
+		typename RContainedT, typename RAllocator>
+	struct DotProductResultDeducer<SMatrix<LContainedT, LRows, LCols>, Matrix<RContainedT, RAllocator>>
 	{
 		using contained = decltype(LContainedT{} * RContainedT{} + LContainedT{} * RContainedT{});
-		using value = Matrix<contained>;
+		using value = Matrix<contained, ReboundAllocator<RAllocator, contained>>;
 	};
 
 	template<typename ContainedT, std::size_t rows, std::size_t cols>
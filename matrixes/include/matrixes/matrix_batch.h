@@ -0,0 +1,262 @@
+#ifndef MATRIX_BATCH_H
+#define MATRIX_BATCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "allocator.h"
+#include "matrix.h"
+#include "simd.h"
+#include "thread_pool.h"
+
+namespace MxLib
+{
+	// Batch of static rows x cols matrixes stored as structure of arrays. Element (row, col) of every
+	// matrix lies in its own contiguous lane, so operations on batch are vectorized across matrixes
+	// and one vector instruction processes the same element of 4 to 16 of them
+	template<typename ContainedT, std::size_t rows, std::size_t cols, typename Allocator = DefaultAllocator<ContainedT>>
+	class SMatrixBatch
+	{
+	public:
+		using contained = ContainedT;
+		using matrix = SMatrix<ContainedT, rows, cols>;
+		using allocator_type = Allocator;
+		const constexpr static std::size_t ROWS = rows;
+		const constexpr static std::size_t COLS = cols;
+
+		SMatrixBatch() :
+			SMatrixBatch(0)
+		{}
+
+		// Matrixes are zero initialized
+		explicit SMatrixBatch(std::size_t count, const Allocator &allocator = Allocator{}) :
+			m_count{count},
+			m_laneStride{LaneStrideFor(count)},
+			m_values(rows * cols * m_laneStride, allocator)
+		{}
+
+		[[nodiscard]] inline std::size_t size() const noexcept { return m_count; }
+		// Distance in elements between lanes, lanes are padded to whole cache lines
+		[[nodiscard]] inline std::size_t LaneStride() const noexcept { return m_laneStride; }
+
+		[[nodiscard]] inline ContainedT *data() noexcept { return m_values.data(); }
+		[[nodiscard]] inline const ContainedT *data() const noexcept { return m_values.data(); }
+
+		[[nodiscard]] inline allocator_type get_allocator() const { return m_values.get_allocator(); }
+
+		// Element (row, col) of every matrix in batch, one after another
+		[[nodiscard]] inline ContainedT *Lane(std::size_t row, std::size_t col)
+		{
+			CheckElement(row, col);
+			return m_values.data() + (row * cols + col) * m_laneStride;
+		}
+		[[nodiscard]] inline const ContainedT *Lane(std::size_t row, std::size_t col) const
+		{
+			CheckElement(row, col);
+			return m_values.data() + (row * cols + col) * m_laneStride;
+		}
+
+		[[nodiscard]] inline ContainedT &operator()(std::size_t index, std::size_t row, std::size_t col)
+		{
+			CheckIndex(index);
+			return Lane(row, col)[index];
+		}
+		[[nodiscard]] inline const ContainedT &operator()(std::size_t index, std::size_t row, std::size_t col) const
+		{
+			CheckIndex(index);
+			return Lane(row, col)[index];
+		}
+
+		// Gathers matrix from lanes, batches are meant to be processed as a whole, so
+		// single matrixes should be taken only at boundaries of batched code
+		[[nodiscard]] matrix Get(std::size_t index) const
+		{
+			CheckIndex(index);
+			matrix gathered{};
+			for (std::size_t pos = 0; pos < rows * cols; ++pos)
+			{
+				gathered.data()[pos] = m_values[pos * m_laneStride + index];
+			}
+			return gathered;
+		}
+
+		void Set(std::size_t index, const matrix &matrixToSet)
+		{
+			CheckIndex(index);
+			for (std::size_t pos = 0; pos < rows * cols; ++pos)
+			{
+				m_values[pos * m_laneStride + index] = matrixToSet.data()[pos];
+			}
+		}
+
+		// Keeps first matrixes that fit into new size, added ones are zero initialized
+		void Resize(std::size_t count)
+		{
+			const std::size_t laneStride = LaneStrideFor(count);
+			std::vector<ContainedT, Allocator> values(rows * cols * laneStride, m_values.get_allocator());
+			const std::size_t kept = std::min(count, m_count);
+			for (std::size_t pos = 0; pos < rows * cols; ++pos)
+			{
+				std::copy_n(m_values.data() + pos * m_laneStride, kept, values.data() + pos * laneStride);
+			}
+			m_values = std::move(values);
+			m_laneStride = laneStride;
+			m_count = count;
+		}
+
+	private:
+		[[nodiscard]] static inline std::size_t LaneStrideFor(std::size_t count) noexcept
+		{
+			constexpr std::size_t PER_LINE = std::max<std::size_t>(CACHE_LINE_SIZE / sizeof(ContainedT), 1);
+			return (count + PER_LINE - 1) / PER_LINE * PER_LINE;
+		}
+
+		inline void CheckIndex([[maybe_unused]] std::size_t index) const
+		{
+#if MATHX_BOUNDS_CHECK
+			if (index >= m_count)
+			{
+				throw std::out_of_range{fmt::format("Index {} is out of batch of {} matrixes", index, m_count)};
+			}
+#endif
+		}
+
+		static inline void CheckElement([[maybe_unused]] std::size_t row, [[maybe_unused]] std::size_t col)
+		{
+#if MATHX_BOUNDS_CHECK
+			if (row >= rows || col >= cols)
+			{
+				detail::ThrowOutOfBounds(rows, cols, row, col);
+			}
+#endif
+		}
+
+		std::size_t m_count;
+		std::size_t m_laneStride;
+		std::vector<ContainedT, Allocator> m_values;
+	};
+
+	namespace detail
+	{
+		template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+		[[nodiscard]] inline simd::BatchProductFunc<T> ActiveBatchProduct() noexcept
+		{
+			static const simd::BatchProductFunc<T> batchProduct{simd::GetBatchProduct<T, ROWS, INNER, COLS>(simd::ActiveIsa())};
+			return batchProduct;
+		}
+
+		template<typename LB, typename RB>
+		void CheckBatchSizes(const LB &lBatch, const RB &rBatch)
+		{
+			if (lBatch.size() != rBatch.size())
+			{
+				throw std::length_error{fmt::format("Batches of {} and {} matrixes cannot be combined",
+					lBatch.size(), rBatch.size())};
+			}
+		}
+	}
+
+	// Products of matrixes with the same index, out may be one of operands
+	template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS, typename Allocator>
+	SMatrixBatch<T, ROWS, COLS, Allocator> &MultiplyInto(const SMatrixBatch<T, ROWS, INNER, Allocator> &lBatch,
+		const SMatrixBatch<T, INNER, COLS, Allocator> &rBatch, SMatrixBatch<T, ROWS, COLS, Allocator> &outBatch)
+	{
+		detail::CheckBatchSizes(lBatch, rBatch);
+		// Output lanes are written while operand lanes of the same matrixes are still read
+		if (static_cast<const void *>(&outBatch) == static_cast<const void *>(&lBatch) ||
+			static_cast<const void *>(&outBatch) == static_cast<const void *>(&rBatch))
+		{
+			SMatrixBatch<T, ROWS, COLS, Allocator> product{lBatch.size(), outBatch.get_allocator()};
+			MultiplyInto(lBatch, rBatch, product);
+			outBatch = std::move(product);
+			return outBatch;
+		}
+		if (outBatch.size() != lBatch.size())
+		{
+			outBatch = SMatrixBatch<T, ROWS, COLS, Allocator>{lBatch.size(), outBatch.get_allocator()};
+		}
+
+		const std::size_t laneStride = lBatch.LaneStride();
+		const T *lhs = lBatch.data();
+		const T *rhs = rBatch.data();
+		T *out = outBatch.data();
+		parallel::ForRows(lBatch.size(), ROWS * INNER * COLS, [&](std::size_t begin, std::size_t end) {
+			if constexpr (simd::SimdSupported<T>)
+			{
+				detail::ActiveBatchProduct<T, ROWS, INNER, COLS>()(lhs + begin, rhs + begin, out + begin, laneStride, end - begin);
+			}
+			else
+			{
+				simd::detail::BatchProductScalar<T, ROWS, INNER, COLS>(lhs, rhs, out, laneStride, begin, end);
+			}
+		});
+		return outBatch;
+	}
+
+	template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS, typename Allocator>
+	[[nodiscard]] SMatrixBatch<T, ROWS, COLS, Allocator> operator*(const SMatrixBatch<T, ROWS, INNER, Allocator> &lBatch,
+		const SMatrixBatch<T, INNER, COLS, Allocator> &rBatch)
+	{
+		detail::CheckBatchSizes(lBatch, rBatch);
+		SMatrixBatch<T, ROWS, COLS, Allocator> outBatch{lBatch.size(), lBatch.get_allocator()};
+		MultiplyInto(lBatch, rBatch, outBatch);
+		return outBatch;
+	}
+
+	// Batches of the same size have the same layout, so they are added as one long array, padding included
+	template<typename T, std::size_t ROWS, std::size_t COLS, typename Allocator>
+	SMatrixBatch<T, ROWS, COLS, Allocator> &operator+=(SMatrixBatch<T, ROWS, COLS, Allocator> &lBatch,
+		const SMatrixBatch<T, ROWS, COLS, Allocator> &rBatch)
+	{
+		detail::CheckBatchSizes(lBatch, rBatch);
+		const std::size_t count = ROWS * COLS * lBatch.LaneStride();
+		if constexpr (simd::SimdSupported<T>)
+		{
+			simd::ActiveKernels<T>().add(lBatch.data(), rBatch.data(), lBatch.data(), count);
+		}
+		else
+		{
+			T *lhs = lBatch.data();
+			const T *rhs = rBatch.data();
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				lhs[index] += rhs[index];
+			}
+		}
+		return lBatch;
+	}
+
+	template<typename T, std::size_t ROWS, std::size_t COLS, typename Allocator>
+	[[nodiscard]] SMatrixBatch<T, ROWS, COLS, Allocator> operator+(const SMatrixBatch<T, ROWS, COLS, Allocator> &lBatch,
+		const SMatrixBatch<T, ROWS, COLS, Allocator> &rBatch)
+	{
+		SMatrixBatch<T, ROWS, COLS, Allocator> outBatch{lBatch};
+		outBatch += rBatch;
+		return outBatch;
+	}
+
+	namespace algo
+	{
+		// Transpose of every matrix is permutation of lanes, lanes themselves are copied as they are
+		template<typename T, std::size_t ROWS, std::size_t COLS, typename Allocator>
+		[[nodiscard]] SMatrixBatch<T, COLS, ROWS, Allocator> Transpose(const SMatrixBatch<T, ROWS, COLS, Allocator> &batch)
+		{
+			SMatrixBatch<T, COLS, ROWS, Allocator> transposed{batch.size(), batch.get_allocator()};
+			for (std::size_t row = 0; row < ROWS; ++row)
+			{
+				for (std::size_t col = 0; col < COLS; ++col)
+				{
+					std::copy_n(batch.Lane(row, col), batch.size(), transposed.Lane(col, row));
+				}
+			}
+			return transposed;
+		}
+	}
+}
+
+#endif // MATRIX_BATCH_H
@@ -1,12 +1,24 @@
 #ifndef MATRIX_CONCEPT_H
 #define MATRIX_CONCEPT_H
 
+#include <algorithm>
 #include <concepts>
+#include <functional>
 #include <type_traits>
 #include <stdexcept>
 
 #include <fmt/format.h>
 
+// Element accessors check bounds unless MATHX_BOUNDS_CHECK is set to 0, by default
+// only debug builds check them. Library loops always access elements unchecked
+#ifndef MATHX_BOUNDS_CHECK
+	#ifdef NDEBUG
+		#define MATHX_BOUNDS_CHECK 0
+	#else
+		#define MATHX_BOUNDS_CHECK 1
+	#endif
+#endif
+
 template<typename T>
 concept ReadonlyMatrixT =
 	requires(T possibleMatrix)
@@ -33,10 +45,33 @@ concept ContinuousStorageMatrix = MatrixT<T> &&
 		{ possibleContinuousMatrix.size() } -> std::convertible_to<std::size_t>;
 	};
 
+// Element (row, col) is stored at data()[row * RowStride() + col * ColStride()], views
+// of such matrixes are strided blocks of the same storage and can be read through pointers
+template<typename T>
+concept StridedStorageMatrix = ReadonlyMatrixT<T> &&
+	requires(const T possibleStridedMatrix)
+	{
+		{ possibleStridedMatrix.data() } -> std::convertible_to<const typename T::contained *>;
+		{ possibleStridedMatrix.RowStride() } -> std::convertible_to<std::size_t>;
+		{ possibleStridedMatrix.ColStride() } -> std::convertible_to<std::size_t>;
+	};
+
 template<typename T>
 concept StaticMatrixT = ReadonlyMatrixT<T> &&
-	std::convertible_to<std::size_t, typename T::COLS> &&
-	std::convertible_to<std::size_t, typename T::ROWS>;
+	requires
+	{
+		{ T::COLS } -> std::convertible_to<std::size_t>;
+		{ T::ROWS } -> std::convertible_to<std::size_t>;
+	};
+
+// Lazily computed result of operation, which is evaluated once assigned to a matrix
+template<typename T>
+concept MatrixExpressionT = ReadonlyMatrixT<T> &&
+	requires
+	{
+		typename T::evaluated;
+		{ T::IS_CONTINUOUS } -> std::convertible_to<bool>;
+	};
 
 template<typename M1, typename M2>
 concept AllowedVectorizedAction = StaticMatrixT<M1> && StaticMatrixT<M2> &&
@@ -48,14 +83,164 @@ concept AllowedDotProductAction = StaticMatrixT<M1> && StaticMatrixT<M2> &&
 
 namespace MxLib
 {
-	template<ReadonlyMatrixT M>
-	constexpr void CheckBounds(const M &matrixToCheck, std::size_t row, std::size_t col)
+	namespace detail
 	{
-		if(row >= matrixToCheck.Rows() || col >= matrixToCheck.Cols())
+		// Kept out of line, so checked accessors stay small enough to be inlined
+		[[noreturn, gnu::cold, gnu::noinline]] inline void ThrowOutOfBounds(std::size_t rows, std::size_t cols,
+			std::size_t row, std::size_t col)
 		{
 			throw std::out_of_range{
 				fmt::format("Reached out of bounds of matrix view {}x{} with row: {} and col: {}",
-					matrixToCheck.Rows(), matrixToCheck.Cols(), row, col)};
+					rows, cols, row, col)};
+		}
+	}
+
+	template<ReadonlyMatrixT M>
+	constexpr void CheckBounds([[maybe_unused]] const M &matrixToCheck,
+		[[maybe_unused]] std::size_t row, [[maybe_unused]] std::size_t col)
+	{
+#if MATHX_BOUNDS_CHECK
+		if(row >= matrixToCheck.Rows() || col >= matrixToCheck.Cols())
+		{
+			detail::ThrowOutOfBounds(matrixToCheck.Rows(), matrixToCheck.Cols(), row, col);
+		}
+#endif
+	}
+
+	// Element access for loops that already keep indexes in bounds, matrixes without
+	// unchecked accessor are accessed as usual
+	template<typename M>
+	[[nodiscard]] constexpr inline decltype(auto) UncheckedAt(M &matrix, std::size_t row, std::size_t col)
+	{
+		if constexpr (requires { matrix.Unchecked(row, col); })
+		{
+			return matrix.Unchecked(row, col);
+		}
+		else
+		{
+			return matrix(row, col);
+		}
+	}
+
+	// Distance between rows in continuous storage, storages without padding keep rows next to each other
+	template<typename M>
+		requires ContinuousStorageMatrix<M> || StridedStorageMatrix<M>
+	[[nodiscard]] constexpr inline std::size_t RowStrideOf(const M &matrix) noexcept
+	{
+		if constexpr (requires { matrix.RowStride(); })
+		{
+			return matrix.RowStride();
+		}
+		else
+		{
+			return matrix.Cols();
+		}
+	}
+
+	// Distance between neighbouring elements of row, only views of columns have it other than 1
+	template<typename M>
+		requires ContinuousStorageMatrix<M> || StridedStorageMatrix<M>
+	[[nodiscard]] constexpr inline std::size_t ColStrideOf(const M &matrix) noexcept
+	{
+		if constexpr (requires { matrix.ColStride(); })
+		{
+			return matrix.ColStride();
+		}
+		else
+		{
+			return 1;
+		}
+	}
+
+	namespace detail
+	{
+		// Copies strided source into row major storage, rows with unit stride are copied as whole blocks
+		template<StridedStorageMatrix M, typename T>
+		constexpr void CopyStrided(const M &source, T *out, std::size_t outRowStride)
+		{
+			const typename M::contained *sourceData = source.data();
+			const std::size_t rowStride = source.RowStride();
+			const std::size_t colStride = source.ColStride();
+			for (std::size_t row = 0; row < source.Rows(); ++row)
+			{
+				const typename M::contained *sourceRow = sourceData + row * rowStride;
+				T *outRow = out + row * outRowStride;
+				if (colStride == 1)
+				{
+					std::copy_n(sourceRow, source.Cols(), outRow);
+					continue;
+				}
+				for (std::size_t col = 0; col < source.Cols(); ++col)
+				{
+					outRow[col] = static_cast<T>(sourceRow[col * colStride]);
+				}
+			}
+		}
+
+		// Whether operand reads memory of output, storages of views are compared by address ranges
+		template<ReadonlyMatrixT M, ContinuousStorageMatrix Out>
+		[[nodiscard]] inline bool SharesStorage(const M &matrix, const Out &out) noexcept
+		{
+			if constexpr (StridedStorageMatrix<M> && std::same_as<typename M::contained, typename Out::contained>)
+			{
+				if (matrix.Rows() == 0 || matrix.Cols() == 0 || out.Rows() == 0 || out.Cols() == 0)
+				{
+					return false;
+				}
+				const auto *first = matrix.data();
+				const auto *last = first + (matrix.Rows() - 1) * RowStrideOf(matrix) + (matrix.Cols() - 1) * ColStrideOf(matrix);
+				const auto *outFirst = out.data();
+				const auto *outLast = outFirst + (out.Rows() - 1) * RowStrideOf(out) + out.Cols() - 1;
+				return std::less_equal<>{}(first, outLast) && std::less_equal<>{}(outFirst, last);
+			}
+			else
+			{
+				return static_cast<const void *>(&matrix) == static_cast<const void *>(&out);
+			}
+		}
+
+		// Whether some element of source is read from storage of out at another position, so source
+		// can't be written to out in place. Elements of expressions depend only on elements at the
+		// same position of operands, so only matrixes and views at their leaves are compared
+		template<ReadonlyMatrixT M, ContinuousStorageMatrix Out>
+		[[nodiscard]] inline bool ReadsOtherPositions(const M &source, const Out &out) noexcept
+		{
+			if constexpr (requires { source.Left(); source.Right(); })
+			{
+				return ReadsOtherPositions(source.Left(), out) || ReadsOtherPositions(source.Right(), out);
+			}
+			else if constexpr (requires { source.Operand(); })
+			{
+				return ReadsOtherPositions(source.Operand(), out);
+			}
+			else if constexpr (StridedStorageMatrix<M> && std::same_as<typename M::contained, typename Out::contained>)
+			{
+				return SharesStorage(source, out) && (source.data() != out.data() ||
+					RowStrideOf(source) != RowStrideOf(out) || ColStrideOf(source) != 1);
+			}
+			else if constexpr (StridedStorageMatrix<M>)
+			{
+				// Storages of other element types are never the same
+				return false;
+			}
+			else
+			{
+				// Views of other storages may still view expressions that read out
+				return requires { typename M::viewed; };
+			}
+		}
+	}
+
+	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
+	inline constexpr void CheckDimensions(const lM &lMatrixToCheck, const rM &rMatrixToCheck)
+	{
+		if(lMatrixToCheck.Cols() != rMatrixToCheck.Cols())
+		{
+			throw std::length_error("Required columns not matched");
+		}
+		else if(lMatrixToCheck.Rows() != rMatrixToCheck.Rows())
+		{
+			throw std::length_error("Required rows not matched");
 		}
 	}
 }
@@ -46,6 +46,10 @@ namespace MxLib
 			CheckBounds(*this, row, col);
 			return m_viewedMatrix(row >= m_excludedRow ? row + 1 : row, col >= m_excludedCol ? col + 1 : col);
 		}
+		[[nodiscard]] constexpr inline const contained &Unchecked(size_t row, size_t col) const
+		{
+			return UncheckedAt(m_viewedMatrix, row >= m_excludedRow ? row + 1 : row, col >= m_excludedCol ? col + 1 : col);
+		}
 
 	private:
 		const Viewed &m_viewedMatrix;
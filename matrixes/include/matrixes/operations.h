@@ -1,44 +1,63 @@
 #ifndef MATRIX_OPERATIONS_H
 #define MATRIX_OPERATIONS_H
 
+#include <cstdint>
+#include <functional>
 #include <random>
+#include <type_traits>
+#include <utility>
 
 #include "operations_deduction.h"
+#include "view.h"
+#include "expressions.h"
+#include "gemm.h"
+#include "random.h"
+#include "scratch_arena.h"
+#include "static_matrixes.h"
+#include "strassen.h"
 
 namespace MxLib
 {
 	static inline constexpr const double DEFAULT_ACCURACY{1e-6};
 
+	// Fills matrix with values uniformly distributed in [startValue, endValue) for floating point
+	// and [startValue, endValue] for integral types. The same seed gives the same matrix whatever
+	// its layout and amount of threads are, values are computed in parallel by Philox generator
 	template<MatrixT M>
-		requires std::floating_point<typename M::contained>
-	M &Randomize(M &matrixToRandomize, typename M::contained startValue, typename M::contained endValue)
+		requires std::floating_point<typename M::contained> || std::integral<typename M::contained>
+	M &Randomize(M &matrixToRandomize, typename M::contained startValue, typename M::contained endValue, std::uint64_t seed)
 	{
-		using namespace std;
-
-		static random_device generator;
-		uniform_real_distribution<typename M::contained> distribution(startValue, endValue);
+		using T = typename M::contained;
 
-		for (size_t row = 0; row < matrixToRandomize.Rows(); row++)
+		if constexpr (std::floating_point<T>)
 		{
-			for (size_t col = 0; col < matrixToRandomize.Cols(); col++)
-			{
-				matrixToRandomize(row, col) = distribution(generator);
-			}
+			detail::FillRandom(matrixToRandomize, seed, detail::UniformRealDistribution<T>{startValue, endValue - startValue});
+		}
+		else
+		{
+			// Width of full 64 bit range wraps to zero
+			const std::uint64_t width = static_cast<std::uint64_t>(endValue) - static_cast<std::uint64_t>(startValue) + 1;
+			detail::FillRandom(matrixToRandomize, seed, detail::UniformIntDistribution<T>{startValue, width});
 		}
 		return matrixToRandomize;
 	}
 
-	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
-	inline constexpr void CheckDimensions(const lM &lMatrixToCheck, const rM &rMatrixToCheck)
+	template<MatrixT M>
+		requires std::floating_point<typename M::contained> || std::integral<typename M::contained>
+	M &Randomize(M &matrixToRandomize, typename M::contained startValue, typename M::contained endValue)
 	{
-		if(lMatrixToCheck.Cols() != rMatrixToCheck.Cols())
-		{
-			throw std::length_error("Required columns not matched");
-		}
-		else if(lMatrixToCheck.Rows() != rMatrixToCheck.Rows())
-		{
-			throw std::length_error("Required rows not matched");
-		}
+		std::random_device device;
+		const std::uint64_t seed = (std::uint64_t{device()} << 32) | device();
+		return Randomize(matrixToRandomize, startValue, endValue, seed);
+	}
+
+	// Fills matrix with normally distributed values, reproducible for the same seed as Randomize
+	template<MatrixT M>
+		requires std::floating_point<typename M::contained>
+	M &RandomizeNormal(M &matrixToRandomize, typename M::contained mean, typename M::contained deviation, std::uint64_t seed)
+	{
+		detail::FillRandom(matrixToRandomize, seed, detail::NormalDistribution<typename M::contained>{mean, deviation});
+		return matrixToRandomize;
 	}
 
 	template<ReadonlyMatrixT M>
@@ -50,20 +69,18 @@ namespace MxLib
 		}
 	}
 
+	// Element-wise product, evaluated lazily as the other element-wise operations
 	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
-	[[nodiscard]] constexpr MultiplicationResult<lM, rM> Multiply(const lM &lMatrixToMultiply, const rM &rMatrixToMultiply)
+	[[nodiscard]] constexpr BinaryExpression<detail::MultiplyOperation, lM, rM> Multiply(const lM &lMatrixToMultiply, const rM &rMatrixToMultiply)
 	{
-		CheckDimensions(lMatrixToMultiply, rMatrixToMultiply);
+		return {lMatrixToMultiply, rMatrixToMultiply};
+	}
 
-		MultiplicationResult<lM, rM> outMatrix{lMatrixToMultiply};
-		for(size_t row = 0; row < lMatrixToMultiply.Rows(); row++)
-		{
-			for (size_t col = 0; col < lMatrixToMultiply.Cols(); col++)
-			{
-				outMatrix(row, col) *= rMatrixToMultiply(row, col);
-			}
-		}
-		return outMatrix;
+	// Element-wise quotient, evaluated lazily
+	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
+	[[nodiscard]] constexpr BinaryExpression<detail::DivideOperation, lM, rM> Divide(const lM &lMatrixToDivide, const rM &rMatrixToDivide)
+	{
+		return {lMatrixToDivide, rMatrixToDivide};
 	}
 
 	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
@@ -81,7 +98,7 @@ namespace MxLib
 		{
 			for(std::size_t col = 0; col < lMatrix.Cols(); col++)
 			{
-				if(std::abs(lMatrix(row, col) - rMatrix(row, col)) > eps)
+				if(std::abs(UncheckedAt(lMatrix, row, col) - UncheckedAt(rMatrix, row, col)) > eps)
 				{
 					return false;
 				}
@@ -97,173 +114,389 @@ namespace MxLib
 		{
 			for(std::size_t col = 0; col < matrixToSet.Cols(); col++)
 			{
-				matrixToSet(row, col) = valueToSet;
+				UncheckedAt(matrixToSet, row, col) = valueToSet;
 			}
 		}
 		return matrixToSet;
 	}
 
-	// Custom operators
-	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
-	constexpr DotProductResult<lM, rM> operator*(const lM &lMatrixToDotProduct, const rM &rMatrixToDotProduct)
+	// Whether operand of matrix product is used as it is or transposed
+	enum class Transposition
 	{
-		if (lMatrixToDotProduct.Cols() != rMatrixToDotProduct.Rows())
+		None,
+		Transposed
+	};
+
+	namespace detail
+	{
+		// Workspace matrix placed in scratch arena, it is valid until enclosing arena scope is closed
+		template<typename T>
+		using ScratchMatrix = Matrix<T, ScratchAllocator<T>>;
+
+		template<typename M>
+		concept GemmStorage = StridedStorageMatrix<M> && std::is_arithmetic_v<typename M::contained>;
+
+		// Transposed operand is described by swapped strides, so it is never materialized
+		template<GemmStorage M>
+		[[nodiscard]] inline GemmOperand<typename M::contained> MakeGemmOperand(const M &matrix, Transposition transposition) noexcept
+		{
+			if (transposition == Transposition::Transposed)
+			{
+				return {matrix.data(), ColStrideOf(matrix), RowStrideOf(matrix)};
+			}
+			return {matrix.data(), RowStrideOf(matrix), ColStrideOf(matrix)};
+		}
+
+		// Output type is checked only for operands that can be multiplied
+		template<typename LM, typename RM, typename OutM>
+		concept SmallGemmT = SmallProductT<LM, RM> && std::same_as<OutM, DotProductResult<LM, RM>>;
+
+		template<typename M>
+		concept TransposeViewT = std::same_as<M, TransposeView<typename M::viewed>>;
+
+		[[nodiscard]] constexpr inline Transposition Flipped(Transposition transposition) noexcept
+		{
+			return transposition == Transposition::Transposed ? Transposition::None : Transposition::Transposed;
+		}
+
+		template<ReadonlyMatrixT M>
+		[[nodiscard]] constexpr inline auto OperandAt(const M &matrix, std::size_t row, std::size_t col, Transposition transposition)
+		{
+			return transposition == Transposition::Transposed ? UncheckedAt(matrix, col, row) : UncheckedAt(matrix, row, col);
+		}
+
+		template<ReadonlyMatrixT M>
+		[[nodiscard]] constexpr inline std::size_t OperandRows(const M &matrix, Transposition transposition) noexcept
+		{
+			return transposition == Transposition::Transposed ? matrix.Cols() : matrix.Rows();
+		}
+
+		template<ReadonlyMatrixT M>
+		[[nodiscard]] constexpr inline std::size_t OperandCols(const M &matrix, Transposition transposition) noexcept
+		{
+			return transposition == Transposition::Transposed ? matrix.Rows() : matrix.Cols();
+		}
+	}
+
+	// BLAS-like product C = alpha * op(A) * op(B) + beta * C into existing matrix, where op(X) is X
+	// or its transpose. C is not read when beta is zero, operands sharing storage with C are copied first
+	template<ReadonlyMatrixT LM, ReadonlyMatrixT RM, MatrixT OutM>
+	constexpr OutM &Gemm(typename OutM::contained alpha, const LM &aMatrix, const RM &bMatrix,
+		typename OutM::contained beta, OutM &cMatrix,
+		Transposition transposeA = Transposition::None, Transposition transposeB = Transposition::None)
+	{
+		using OutT = typename OutM::contained;
+
+		const std::size_t rows = detail::OperandRows(aMatrix, transposeA);
+		const std::size_t inner = detail::OperandCols(aMatrix, transposeA);
+		const std::size_t cols = detail::OperandCols(bMatrix, transposeB);
+		if (inner != detail::OperandRows(bMatrix, transposeB))
 		{
 			throw std::length_error("Columns of left matrix doesn't match rows of right one");
 		}
+		if (cMatrix.Rows() != rows || cMatrix.Cols() != cols)
+		{
+			throw std::length_error{fmt::format("Product is {}x{} matrix, but output is {}x{}",
+				rows, cols, cMatrix.Rows(), cMatrix.Cols())};
+		}
 
-		auto out{MatrixConstructor<DotProductResult<lM, rM>>::Create(lMatrixToDotProduct.Rows(), rMatrixToDotProduct.Cols())};
-		for (std::size_t row = 0; row < lMatrixToDotProduct.Rows(); row++)
+		// Transposed views are turned into transposition of viewed matrix, which is packed in the order it is stored
+		if constexpr (detail::TransposeViewT<LM>)
 		{
-			for (std::size_t col = 0; col < rMatrixToDotProduct.Cols(); col++) 
+			return Gemm(alpha, aMatrix.Viewed(), bMatrix, beta, cMatrix, detail::Flipped(transposeA), transposeB);
+		}
+		else if constexpr (detail::TransposeViewT<RM>)
+		{
+			return Gemm(alpha, aMatrix, bMatrix.Viewed(), beta, cMatrix, transposeA, detail::Flipped(transposeB));
+		}
+		// Every element of operand is read many times, so expressions are evaluated once beforehand
+		else if constexpr (MatrixExpressionT<LM>)
+		{
+			return Gemm(alpha, EvaluatedMatrix<LM>{aMatrix}, bMatrix, beta, cMatrix, transposeA, transposeB);
+		}
+		else if constexpr (MatrixExpressionT<RM>)
+		{
+			return Gemm(alpha, aMatrix, EvaluatedMatrix<RM>{bMatrix}, beta, cMatrix, transposeA, transposeB);
+		}
+		else
+		{
+			if constexpr (detail::SmallGemmT<LM, RM, OutM>)
 			{
-				auto &val = out(row, col);
-				val = 0;
-				for (std::size_t iter = 0; iter < rMatrixToDotProduct.Rows(); iter++)
+				// Product is kept aside until output is updated, so operands may share storage with it
+				if (transposeA == Transposition::None && transposeB == Transposition::None)
 				{
-					val += lMatrixToDotProduct(row, iter) * rMatrixToDotProduct(iter, col);
+					const OutM product = detail::SmallProduct(aMatrix, bMatrix);
+					for (std::size_t pos = 0; pos < OutM::ROWS * OutM::COLS; pos++)
+					{
+						auto &val = cMatrix.data()[pos];
+						val = beta == OutT{} ? alpha * product.data()[pos] : alpha * product.data()[pos] + beta * val;
+					}
+					return cMatrix;
 				}
 			}
+			if (!std::is_constant_evaluated())
+			{
+				// Output is written while operands are still read, so operands sharing its storage are copied
+				const bool aShared = detail::SharesStorage(aMatrix, cMatrix);
+				const bool bShared = detail::SharesStorage(bMatrix, cMatrix);
+				if (aShared || bShared)
+				{
+					using LT = typename LM::contained;
+					using RT = typename RM::contained;
+
+					ScratchArena &arena{ThreadScratchArena()};
+					const ScratchArena::Scope scope{arena};
+					if (aShared && bShared)
+					{
+						const detail::ScratchMatrix<LT> copiedA{aMatrix, ScratchAllocator<LT>{arena}};
+						const detail::ScratchMatrix<RT> copiedB{bMatrix, ScratchAllocator<RT>{arena}};
+						return Gemm(alpha, copiedA, copiedB, beta, cMatrix, transposeA, transposeB);
+					}
+					if (aShared)
+					{
+						const detail::ScratchMatrix<LT> copiedA{aMatrix, ScratchAllocator<LT>{arena}};
+						return Gemm(alpha, copiedA, bMatrix, beta, cMatrix, transposeA, transposeB);
+					}
+					const detail::ScratchMatrix<RT> copiedB{bMatrix, ScratchAllocator<RT>{arena}};
+					return Gemm(alpha, aMatrix, copiedB, beta, cMatrix, transposeA, transposeB);
+				}
+
+				if constexpr (detail::GemmStorage<LM> && detail::GemmStorage<RM> &&
+					detail::GemmStorage<OutM> && ContinuousStorageMatrix<OutM>)
+				{
+					if constexpr (strassen::ApplicableT<OutT, typename LM::contained, typename RM::contained>)
+					{
+						if (strassen::ShouldUse(rows, cols, inner))
+						{
+							detail::GemmStrassen(rows, cols, inner, alpha,
+								detail::MakeGemmOperand(aMatrix, transposeA), detail::MakeGemmOperand(bMatrix, transposeB),
+								beta, cMatrix.data(), RowStrideOf(cMatrix));
+							return cMatrix;
+						}
+					}
+					detail::Gemm(rows, cols, inner, alpha,
+						detail::MakeGemmOperand(aMatrix, transposeA), detail::MakeGemmOperand(bMatrix, transposeB),
+						beta, cMatrix.data(), RowStrideOf(cMatrix));
+					return cMatrix;
+				}
+			}
+
+			// Generic fallback for matrixes without strided storage
+			for (std::size_t row = 0; row < rows; row++)
+			{
+				for (std::size_t col = 0; col < cols; col++)
+				{
+					OutT sum{};
+					for (std::size_t iter = 0; iter < inner; iter++)
+					{
+						sum += detail::OperandAt(aMatrix, row, iter, transposeA) * detail::OperandAt(bMatrix, iter, col, transposeB);
+					}
+					auto &val = UncheckedAt(cMatrix, row, col);
+					val = beta == OutT{} ? alpha * sum : alpha * sum + beta * val;
+				}
+			}
+			return cMatrix;
 		}
+	}
 
-		return out;
+	// Matrix product written into existing matrix of the right size, C = op(A) * op(B)
+	template<ReadonlyMatrixT LM, ReadonlyMatrixT RM, MatrixT OutM>
+	constexpr OutM &MultiplyInto(const LM &aMatrix, const RM &bMatrix, OutM &cMatrix,
+		Transposition transposeA = Transposition::None, Transposition transposeB = Transposition::None)
+	{
+		using OutT = typename OutM::contained;
+		return Gemm(OutT{1}, aMatrix, bMatrix, OutT{0}, cMatrix, transposeA, transposeB);
 	}
 
+	// Custom operators
 	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
-	constexpr SumResult<lM, rM> operator+(const lM &lMatrix, const rM &rMatrix)
+	constexpr DotProductResult<lM, rM> operator*(const lM &lMatrixToDotProduct, const rM &rMatrixToDotProduct)
 	{
-		CheckDimensions(lMatrix, rMatrix);
-
-		SumResult<lM, rM> outMatrix{lMatrix};
-		for (size_t row = 0; row < lMatrix.Rows(); row++)
+		if constexpr (SmallProductT<lM, rM>)
 		{
-			for (size_t col = 0; col < lMatrix.Cols(); col++)
-			{
-				outMatrix(row, col) = lMatrix(row, col) + rMatrix(row, col);
-			}
+			return detail::SmallProduct(lMatrixToDotProduct, rMatrixToDotProduct);
+		}
+		if (lMatrixToDotProduct.Cols() != rMatrixToDotProduct.Rows())
+		{
+			throw std::length_error("Columns of left matrix doesn't match rows of right one");
 		}
 
-		return outMatrix;
+		auto out{MatrixConstructor<DotProductResult<lM, rM>>::Create(lMatrixToDotProduct.Rows(), rMatrixToDotProduct.Cols())};
+		MultiplyInto(lMatrixToDotProduct, rMatrixToDotProduct, out);
+		return out;
+	}
+
+	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
+	constexpr BinaryExpression<detail::AddOperation, lM, rM> operator+(const lM &lMatrix, const rM &rMatrix)
+	{
+		return {lMatrix, rMatrix};
 	}
 
 	template<ReadonlyMatrixT lM, ReadonlyMatrixT rM>
-	constexpr SubtractionResult<lM, rM> operator-(const lM &lMatrix, const rM &rMatrix)
+	constexpr BinaryExpression<detail::SubtractOperation, lM, rM> operator-(const lM &lMatrix, const rM &rMatrix)
 	{
-		CheckDimensions(lMatrix, rMatrix);
+		return {lMatrix, rMatrix};
+	}
 
-		SubtractionResult<lM, rM> outMatrix{lMatrix};
-		for (size_t row = 0; row < lMatrix.Rows(); row++)
+	namespace detail
+	{
+		// Applies operation to every element of target with element of other matrix at the same position
+		template<typename Operation, MatrixT M, ReadonlyMatrixT R>
+		constexpr M &ApplyInplace(M &target, const R &other)
 		{
-			for (size_t col = 0; col < lMatrix.Cols(); col++)
+			using T = typename M::contained;
+			CheckDimensions(target, other);
+
+			// Other matrix reading target at other positions, like its transpose, is copied first
+			if constexpr (ContinuousStorageMatrix<M>)
 			{
-				outMatrix(row, col) -= rMatrix(row, col);
+				if (!std::is_constant_evaluated() && ReadsOtherPositions(other, target))
+				{
+					using OtherT = typename R::contained;
+					ScratchArena &arena{ThreadScratchArena()};
+					const ScratchArena::Scope scope{arena};
+					const ScratchMatrix<OtherT> copied{other, ScratchAllocator<OtherT>{arena}};
+					return ApplyInplace<Operation>(target, copied);
+				}
 			}
-		}
 
-		return outMatrix;
-	}
+			if constexpr (KernelOperands<T, M, R> && requires { Operation::template ElementwiseKernel<T>(); })
+			{
+				if (!std::is_constant_evaluated() && CanRunKernel(target, other))
+				{
+					RunElementwiseKernel(Operation::template ElementwiseKernel<T>(), target, other, target);
+					return target;
+				}
+			}
 
-	template<MatrixT lM, ReadonlyMatrixT rM>
-	constexpr SumResult<lM> &operator+=(lM &lMatrix, const rM &rMatrix)
-	{
-		CheckDimensions(lMatrix, rMatrix);
+			for (std::size_t row = 0; row < target.Rows(); row++)
+			{
+				for (std::size_t col = 0; col < target.Cols(); col++)
+				{
+					T &value = UncheckedAt(target, row, col);
+					value = static_cast<T>(Operation::Apply(value, UncheckedAt(other, row, col)));
+				}
+			}
+			return target;
+		}
 
-		for (size_t row = 0; row < lMatrix.Rows(); row++)
+		// Applies operation to every element of target with the same scalar
+		template<typename Operation, MatrixT M, typename S>
+		constexpr M &ApplyScalarInplace(M &target, const S &scalar)
 		{
-			for (size_t col = 0; col < lMatrix.Cols(); col++)
+			using T = typename M::contained;
+			// Scalar is converted to floating point elements once, e.g. MatrixF *= 2.0 runs in float,
+			// integral elements keep the scalar as is, so MatrixI *= 2.5 is not truncated to * 2
+			using Scalar = std::conditional_t<std::floating_point<T> && std::is_arithmetic_v<S>, T, S>;
+			const Scalar converted = static_cast<Scalar>(scalar);
+
+			if constexpr (KernelOperands<T, M> && std::same_as<decltype(Operation::Apply(std::declval<T>(), std::declval<Scalar>())), T> &&
+				requires { Operation::template ScalarKernel<T>(); })
 			{
-				lMatrix(row, col) += rMatrix(row, col);
+				if (!std::is_constant_evaluated() && CanRunKernel(target))
+				{
+					RunScalarKernel(Operation::template ScalarKernel<T>(), target, static_cast<T>(converted), target);
+					return target;
+				}
 			}
+
+			for (std::size_t row = 0; row < target.Rows(); row++)
+			{
+				for (std::size_t col = 0; col < target.Cols(); col++)
+				{
+					T &value = UncheckedAt(target, row, col);
+					value = static_cast<T>(Operation::Apply(value, converted));
+				}
+			}
+			return target;
 		}
-		return lMatrix;
+	}
+
+	template<MatrixT lM, ReadonlyMatrixT rM>
+	constexpr SumResult<lM> &operator+=(lM &lMatrix, const rM &rMatrix)
+	{
+		return detail::ApplyInplace<detail::AddOperation>(lMatrix, rMatrix);
 	}
 
 	template<MatrixT lM, ReadonlyMatrixT rM>
 	constexpr SubtractionResult<lM> &operator-=(lM &lMatrix, const rM &rMatrix)
 	{
-		CheckDimensions(lMatrix, rMatrix);
+		return detail::ApplyInplace<detail::SubtractOperation>(lMatrix, rMatrix);
+	}
 
-		for (size_t row = 0; row < lMatrix.Rows(); row++)
-		{
-			for (size_t col = 0; col < lMatrix.Cols(); col++)
-			{
-				lMatrix(row, col) -= rMatrix(row, col);
-			}
-		}
-		return lMatrix;
+	// Element-wise product written into left matrix, same as lMatrix = Multiply(lMatrix, rMatrix)
+	template<MatrixT lM, ReadonlyMatrixT rM>
+	constexpr lM &MultiplyInplace(lM &lMatrix, const rM &rMatrix)
+	{
+		return detail::ApplyInplace<detail::MultiplyOperation>(lMatrix, rMatrix);
+	}
+
+	// Element-wise quotient written into left matrix, same as lMatrix = Divide(lMatrix, rMatrix)
+	template<MatrixT lM, ReadonlyMatrixT rM>
+	constexpr lM &DivideInplace(lM &lMatrix, const rM &rMatrix)
+	{
+		return detail::ApplyInplace<detail::DivideOperation>(lMatrix, rMatrix);
+	}
+
+	// Scalar assignment operations, matrix is changed in place without temporary
+	template<MatrixT M, typename T>
+		requires (!ReadonlyMatrixT<T>)
+	constexpr M &operator*=(M &matrixToChange, const T &numberToMultiply)
+	{
+		return detail::ApplyScalarInplace<detail::MultiplyOperation>(matrixToChange, numberToMultiply);
+	}
+
+	template<MatrixT M, typename T>
+		requires (!ReadonlyMatrixT<T>)
+	constexpr M &operator/=(M &matrixToChange, const T &numberToDivide)
+	{
+		return detail::ApplyScalarInplace<detail::DivideOperation>(matrixToChange, numberToDivide);
+	}
+
+	template<MatrixT M, typename T>
+		requires (!ReadonlyMatrixT<T>)
+	constexpr M &operator+=(M &matrixToChange, const T &numberToAdd)
+	{
+		return detail::ApplyScalarInplace<detail::AddOperation>(matrixToChange, numberToAdd);
+	}
+
+	template<MatrixT M, typename T>
+		requires (!ReadonlyMatrixT<T>)
+	constexpr M &operator-=(M &matrixToChange, const T &numberToSubtract)
+	{
+		return detail::ApplyScalarInplace<detail::SubtractOperation>(matrixToChange, numberToSubtract);
 	}
 
-	// TODO: add scalar assignment operations
 	// Operations with scalar values
 	template<ReadonlyMatrixT M, typename T>
-	constexpr ScalarResult<M, M, decltype(typename M::contained{} / T{})> operator/(const M &matrixToChange, const T &numberToDivide)
+	constexpr ScalarExpression<detail::DivideOperation, M, T> operator/(const M &matrixToChange, const T &numberToDivide)
 	{
-		ScalarResult<M, M, decltype(typename M::contained{} / T{})> outMatrix{matrixToChange};
-		for (size_t row = 0; row < matrixToChange.Rows(); row++)
-		{
-			for (size_t col = 0; col < matrixToChange.Cols(); col++)
-			{
-				outMatrix(row, col) /= numberToDivide;
-			}
-		}
-		return outMatrix;
+		return {matrixToChange, numberToDivide};
 	}
 
 	template<ReadonlyMatrixT M, typename T>
-	constexpr ScalarResult<M, M, decltype(typename M::contained{} * T{})> operator*(const M &matrixToChange, const T &numberToMultiply)
+	constexpr ScalarExpression<detail::MultiplyOperation, M, T> operator*(const M &matrixToChange, const T &numberToMultiply)
 	{
-		ScalarResult<M, M, decltype(typename M::contained{} * T{})> outMatrix{matrixToChange};
-		for (size_t row = 0; row < matrixToChange.Rows(); row++)
-		{
-			for (size_t col = 0; col < matrixToChange.Cols(); col++)
-			{
-				outMatrix(row, col) *= numberToMultiply;
-			}
-		}
-		return outMatrix;
+		return {matrixToChange, numberToMultiply};
 	}
 
 	template<ReadonlyMatrixT M, typename T>
-	constexpr ScalarResult<M, M, decltype(typename M::contained{} + T{})> operator+(const M &matrixToChange, const T &numberToAdd)
+	constexpr ScalarExpression<detail::AddOperation, M, T> operator+(const M &matrixToChange, const T &numberToAdd)
 	{
-		ScalarResult<M, M, decltype(typename M::contained{} + T{})> outMatrix{matrixToChange};
-		for (size_t row = 0; row < matrixToChange.Rows(); row++)
-		{
-			for (size_t col = 0; col < matrixToChange.Cols(); col++)
-			{
-				outMatrix(row, col) += numberToAdd;
-			}
-		}
-		return outMatrix;
+		return {matrixToChange, numberToAdd};
 	}
 
 	template<ReadonlyMatrixT M, typename T>
-	constexpr ScalarResult<M, M, decltype(typename M::contained{} - T{})> operator-(const M &matrixToChange, const T &numberToSubtract)
+	constexpr ScalarExpression<detail::SubtractOperation, M, T> operator-(const M &matrixToChange, const T &numberToSubtract)
 	{
-		ScalarResult<M, M, decltype(typename M::contained{} - T{})> outMatrix{matrixToChange};
-		for (size_t row = 0; row < matrixToChange.Rows(); row++)
-		{
-			for (size_t col = 0; col < matrixToChange.Cols(); col++)
-			{
-				outMatrix(row, col) -= numberToSubtract;
-			}
-		}
-		return outMatrix;
+		return {matrixToChange, numberToSubtract};
 	}
 
 	// Unary
 	template<ReadonlyMatrixT M>
-	constexpr NegativeResult<M> operator-(const M &matrixToChange)
+	constexpr UnaryExpression<detail::NegateOperation, M> operator-(const M &matrixToChange)
 	{
-		NegativeResult<M> negativeMatrix{matrixToChange};
-		for (size_t row = 0; row < matrixToChange.Rows(); row++)
-		{
-			for (size_t col = 0; col < matrixToChange.Cols(); col++)
-			{
-				negativeMatrix(row, col) = -negativeMatrix(row, col);
-			}
-		}
-		return negativeMatrix;
+		return UnaryExpression<detail::NegateOperation, M>{matrixToChange};
 	}
 }
 
@@ -0,0 +1,282 @@
+#ifndef MATRIX_RANDOM_H
+#define MATRIX_RANDOM_H
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "matrix_concepts.h"
+#include "thread_pool.h"
+
+namespace MxLib
+{
+	// Philox4x32-10 counter-based generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+	// Block of four 32 bit words is a keyed bijection of 128 bit counter, so any block can be computed
+	// independently of others and parts of matrix can be filled in any order by any amount of threads
+	class Philox4x32
+	{
+	public:
+		using Block = std::uint32_t[4];
+
+		// Blocks that are computed together, lanes are independent, so loops over them are vectorized
+		static inline constexpr const std::size_t LANES{8};
+
+		explicit constexpr Philox4x32(std::uint64_t seed) noexcept :
+			m_key{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}
+		{}
+
+		constexpr Philox4x32(std::uint32_t key0, std::uint32_t key1) noexcept :
+			m_key{key0, key1}
+		{}
+
+		// Block for 128 bit counter given as four words
+		constexpr void Generate(const Block &counter, Block &out) const noexcept
+		{
+			std::uint32_t c0[1]{counter[0]};
+			std::uint32_t c1[1]{counter[1]};
+			std::uint32_t c2[1]{counter[2]};
+			std::uint32_t c3[1]{counter[3]};
+			Rounds<1>(c0, c1, c2, c3);
+			out[0] = c0[0];
+			out[1] = c1[0];
+			out[2] = c2[0];
+			out[3] = c3[0];
+		}
+
+		// Blocks for counters first, first + 1, ..., first + LANES - 1, words of lane are out[0..3][lane]
+		constexpr void GenerateLanes(std::uint64_t first, std::uint32_t (&out)[4][LANES]) const noexcept
+		{
+			for (std::size_t lane = 0; lane < LANES; ++lane)
+			{
+				const std::uint64_t counter = first + lane;
+				out[0][lane] = static_cast<std::uint32_t>(counter);
+				out[1][lane] = static_cast<std::uint32_t>(counter >> 32);
+				out[2][lane] = 0;
+				out[3][lane] = 0;
+			}
+			Rounds<LANES>(out[0], out[1], out[2], out[3]);
+		}
+
+	private:
+		static inline constexpr const std::uint32_t MULTIPLIER_0{0xD2511F53};
+		static inline constexpr const std::uint32_t MULTIPLIER_1{0xCD9E8D57};
+		static inline constexpr const std::uint32_t WEYL_0{0x9E3779B9};
+		static inline constexpr const std::uint32_t WEYL_1{0xBB67AE85};
+		static inline constexpr const std::size_t ROUNDS{10};
+
+		template<std::size_t COUNT>
+		constexpr void Rounds(std::uint32_t *c0, std::uint32_t *c1, std::uint32_t *c2, std::uint32_t *c3) const noexcept
+		{
+			std::uint32_t key0 = m_key[0];
+			std::uint32_t key1 = m_key[1];
+			for (std::size_t round = 0; round < ROUNDS; ++round)
+			{
+				for (std::size_t lane = 0; lane < COUNT; ++lane)
+				{
+					const std::uint64_t product0 = std::uint64_t{MULTIPLIER_0} * c0[lane];
+					const std::uint64_t product1 = std::uint64_t{MULTIPLIER_1} * c2[lane];
+					const auto next0 = static_cast<std::uint32_t>(product1 >> 32) ^ c1[lane] ^ key0;
+					const auto next2 = static_cast<std::uint32_t>(product0 >> 32) ^ c3[lane] ^ key1;
+					c1[lane] = static_cast<std::uint32_t>(product1);
+					c3[lane] = static_cast<std::uint32_t>(product0);
+					c0[lane] = next0;
+					c2[lane] = next2;
+				}
+				key0 += WEYL_0;
+				key1 += WEYL_1;
+			}
+		}
+
+		std::uint32_t m_key[2];
+	};
+
+	namespace detail
+	{
+		[[nodiscard]] constexpr inline std::uint64_t Join(std::uint32_t high, std::uint32_t low) noexcept
+		{
+			return (std::uint64_t{high} << 32) | low;
+		}
+
+		// High 64 bits of 128 bit product, computed from 32 bit halves as standard C++ has no wider type
+		[[nodiscard]] constexpr inline std::uint64_t MultiplyHigh(std::uint64_t lhs, std::uint64_t rhs) noexcept
+		{
+			const std::uint64_t lhsLow = lhs & 0xFFFFFFFF;
+			const std::uint64_t lhsHigh = lhs >> 32;
+			const std::uint64_t rhsLow = rhs & 0xFFFFFFFF;
+			const std::uint64_t rhsHigh = rhs >> 32;
+
+			const std::uint64_t low = lhsLow * rhsLow;
+			const std::uint64_t middle = lhsHigh * rhsLow + (low >> 32);
+			const std::uint64_t cross = lhsLow * rhsHigh + (middle & 0xFFFFFFFF);
+			return lhsHigh * rhsHigh + (middle >> 32) + (cross >> 32);
+		}
+
+		// Uniform in [0, 1) from top bits of random word, as many as mantissa holds
+		template<std::floating_point T>
+		[[nodiscard]] constexpr inline T UnitInterval(std::uint64_t bits) noexcept
+		{
+			constexpr int DIGITS = std::numeric_limits<T>::digits;
+			return static_cast<T>(bits >> (64 - DIGITS)) * (T{1} / static_cast<T>(std::uint64_t{1} << DIGITS));
+		}
+
+		// Distributions turn one Philox block into PER_BLOCK values, element with linear index i takes
+		// value PER_BLOCK * counter + i % PER_BLOCK, so values don't depend on how matrix is split
+		template<std::floating_point T>
+		struct UniformRealDistribution
+		{
+			// Floats need only one word, doubles two
+			static inline constexpr const std::size_t PER_BLOCK{sizeof(T) <= 4 ? 4 : 2};
+
+			T start;
+			T width;
+
+			constexpr inline void operator()(const std::uint32_t *words, std::size_t stride, T *out) const noexcept
+			{
+				for (std::size_t pos = 0; pos < PER_BLOCK; ++pos)
+				{
+					const std::uint64_t bits = PER_BLOCK == 4 ? std::uint64_t{words[pos * stride]} << 32 :
+						Join(words[2 * pos * stride], words[(2 * pos + 1) * stride]);
+					out[pos] = start + width * UnitInterval<T>(bits);
+				}
+			}
+		};
+
+		// Integers in [start, end] by multiplying 64 random bits by width of range, bias is below width / 2^64
+		template<std::integral T>
+		struct UniformIntDistribution
+		{
+			static inline constexpr const std::size_t PER_BLOCK{2};
+
+			T start;
+			// Zero is full range of 64 bit type
+			std::uint64_t width;
+
+			constexpr inline void operator()(const std::uint32_t *words, std::size_t stride, T *out) const noexcept
+			{
+				for (std::size_t pos = 0; pos < PER_BLOCK; ++pos)
+				{
+					const std::uint64_t bits = Join(words[2 * pos * stride], words[(2 * pos + 1) * stride]);
+					const std::uint64_t offset = width == 0 ? bits : MultiplyHigh(bits, width);
+					out[pos] = static_cast<T>(static_cast<std::uint64_t>(start) + offset);
+				}
+			}
+		};
+
+		// Box-Muller transform, two uniform values of block give two normal ones
+		template<std::floating_point T>
+		struct NormalDistribution
+		{
+			static inline constexpr const std::size_t PER_BLOCK{2};
+
+			T mean;
+			T deviation;
+
+			inline void operator()(const std::uint32_t *words, std::size_t stride, T *out) const noexcept
+			{
+				// First value is taken from (0, 1], so its logarithm is finite
+				const double radius = std::sqrt(-2.0 * std::log(1.0 - UnitInterval<double>(Join(words[0], words[stride]))));
+				const double angle = 2.0 * std::numbers::pi * UnitInterval<double>(Join(words[2 * stride], words[3 * stride]));
+				out[0] = mean + deviation * static_cast<T>(radius * std::cos(angle));
+				out[1] = mean + deviation * static_cast<T>(radius * std::sin(angle));
+			}
+		};
+
+		// Writes values of elements with linear indexes [first, first + count) to out
+		template<typename T, typename Distribution>
+		void GenerateRange(const Philox4x32 &generator, const Distribution &distribution,
+			std::uint64_t first, std::size_t count, T *out) noexcept
+		{
+			constexpr std::size_t PER_BLOCK = Distribution::PER_BLOCK;
+			constexpr std::size_t LANES = Philox4x32::LANES;
+
+			const std::uint64_t end = first + count;
+			std::uint32_t words[4][LANES];
+			for (std::uint64_t block = first / PER_BLOCK; block * PER_BLOCK < end; block += LANES)
+			{
+				generator.GenerateLanes(block, words);
+				for (std::size_t lane = 0; lane < LANES; ++lane)
+				{
+					const std::uint64_t laneFirst = (block + lane) * PER_BLOCK;
+					if (laneFirst >= end)
+					{
+						break;
+					}
+					if (laneFirst >= first && laneFirst + PER_BLOCK <= end)
+					{
+						distribution(&words[0][lane], LANES, out + (laneFirst - first));
+						continue;
+					}
+					// Blocks at the ends of range are shared with neighbouring ranges
+					T values[PER_BLOCK];
+					distribution(&words[0][lane], LANES, values);
+					for (std::size_t pos = 0; pos < PER_BLOCK; ++pos)
+					{
+						if (laneFirst + pos >= first && laneFirst + pos < end)
+						{
+							out[laneFirst + pos - first] = values[pos];
+						}
+					}
+				}
+			}
+		}
+
+		// Element (row, col) takes value of linear index row * Cols() + col, so result is the same
+		// for every layout of storage and every amount of threads
+		template<MatrixT M, typename Distribution>
+		void FillRandom(M &matrix, std::uint64_t seed, const Distribution &distribution)
+		{
+			using T = typename M::contained;
+
+			const Philox4x32 generator{seed};
+			const std::size_t rows = matrix.Rows();
+			const std::size_t cols = matrix.Cols();
+			// Elements are written without checks below, so storage that cannot be written,
+			// like mapped pages opened for reading, is rejected by checked accessor first
+			if (rows != 0 && cols != 0)
+			{
+				static_cast<void>(matrix(0, 0));
+			}
+			// Roughly amount of scalar operations one element takes
+			constexpr std::size_t OPERATIONS_PER_ELEMENT = 16;
+			parallel::ForRows(rows, cols * OPERATIONS_PER_ELEMENT, [&](std::size_t rowBegin, std::size_t rowEnd) {
+				// Rows stored continuously are written in place
+				if constexpr (StridedStorageMatrix<M> && std::same_as<decltype(std::declval<M &>().data()), T *>)
+				{
+					if (ColStrideOf(matrix) == 1)
+					{
+						T *data = matrix.data();
+						const std::size_t rowStride = RowStrideOf(matrix);
+						if (rowStride == cols)
+						{
+							GenerateRange(generator, distribution, rowBegin * cols, (rowEnd - rowBegin) * cols, data + rowBegin * cols);
+							return;
+						}
+						for (std::size_t row = rowBegin; row < rowEnd; ++row)
+						{
+							GenerateRange(generator, distribution, row * cols, cols, data + row * rowStride);
+						}
+						return;
+					}
+				}
+				std::vector<T> rowValues(cols);
+				for (std::size_t row = rowBegin; row < rowEnd; ++row)
+				{
+					GenerateRange(generator, distribution, row * cols, cols, rowValues.data());
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						UncheckedAt(matrix, row, col) = rowValues[col];
+					}
+				}
+			});
+		}
+	}
+}
+
+#endif // MATRIX_RANDOM_H
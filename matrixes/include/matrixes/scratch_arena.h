@@ -0,0 +1,189 @@
+#ifndef MATRIX_SCRATCH_ARENA_H
+#define MATRIX_SCRATCH_ARENA_H
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "allocator.h"
+
+namespace MxLib
+{
+	// Bump allocator for short lived workspaces. Memory is taken in growing blocks that are
+	// kept for later use, so once arena has grown to the size of workload it doesn't allocate.
+	// Allocations are freed all at once when Scope that was opened before them is closed,
+	// destructors of objects placed in arena are never called
+	class ScratchArena
+	{
+	public:
+		static inline constexpr const std::size_t DEFAULT_BLOCK_SIZE{std::size_t{1} << 16};
+
+		// Rewinds arena to the state it had when scope was opened, scopes should be closed
+		// in reverse order of opening
+		class Scope
+		{
+		public:
+			explicit Scope(ScratchArena &arena) noexcept :
+				m_arena{&arena},
+				m_block{arena.m_block},
+				m_offset{arena.m_offset}
+			{}
+
+			Scope(const Scope &) = delete;
+			Scope &operator=(const Scope &) = delete;
+			Scope(Scope &&) = delete;
+			Scope &operator=(Scope &&) = delete;
+
+			~Scope() noexcept
+			{
+				m_arena->m_block = m_block;
+				m_arena->m_offset = m_offset;
+			}
+
+		private:
+			ScratchArena *m_arena;
+			std::size_t m_block;
+			std::size_t m_offset;
+		};
+
+		// No memory is taken until the first allocation
+		explicit ScratchArena(std::size_t firstBlockSize = DEFAULT_BLOCK_SIZE) noexcept :
+			m_firstBlockSize{std::max(firstBlockSize, CACHE_LINE_SIZE)}
+		{}
+
+		ScratchArena(const ScratchArena &) = delete;
+		ScratchArena &operator=(const ScratchArena &) = delete;
+		ScratchArena(ScratchArena &&) = delete;
+		ScratchArena &operator=(ScratchArena &&) = delete;
+
+		~ScratchArena() noexcept = default;
+
+		// Uninitialized storage for count objects of T, aligned to cache line
+		template<typename T>
+		[[nodiscard]] T *Allocate(std::size_t count)
+		{
+			static_assert(alignof(T) <= CACHE_LINE_SIZE, "Arena cannot align objects stricter than cache line");
+			if (count == 0)
+			{
+				return nullptr;
+			}
+			if (count > (std::numeric_limits<std::size_t>::max() - CACHE_LINE_SIZE) / sizeof(T))
+			{
+				throw std::bad_array_new_length{};
+			}
+			// Sizes are rounded, so every allocation starts at cache line
+			const std::size_t bytes = (count * sizeof(T) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+			return static_cast<T *>(AllocateBytes(bytes));
+		}
+
+		// Bytes taken by blocks, used or not
+		[[nodiscard]] inline std::size_t Capacity() const noexcept
+		{
+			std::size_t capacity{0};
+			for (const Block &block : m_blocks)
+			{
+				capacity += block.size;
+			}
+			return capacity;
+		}
+
+		// Frees all blocks, no scope should be open and no memory from arena should be in use
+		void Release() noexcept
+		{
+			m_blocks.clear();
+			m_block = 0;
+			m_offset = 0;
+		}
+
+	private:
+		struct BlockDeleter
+		{
+			void operator()(std::byte *block) const noexcept
+			{
+				::operator delete[](block, std::align_val_t{CACHE_LINE_SIZE});
+			}
+		};
+
+		struct Block
+		{
+			std::unique_ptr<std::byte[], BlockDeleter> data;
+			std::size_t size;
+		};
+
+		void *AllocateBytes(std::size_t bytes)
+		{
+			// Blocks after current one are left from previous scopes and are reused first
+			for (; m_block < m_blocks.size(); ++m_block, m_offset = 0)
+			{
+				if (bytes <= m_blocks[m_block].size - m_offset)
+				{
+					void *allocated = m_blocks[m_block].data.get() + m_offset;
+					m_offset += bytes;
+					return allocated;
+				}
+			}
+
+			const std::size_t blockSize = std::max(bytes, m_blocks.empty() ? m_firstBlockSize : m_blocks.back().size * 2);
+			m_blocks.push_back(Block{
+				std::unique_ptr<std::byte[], BlockDeleter>{
+					static_cast<std::byte *>(::operator new[](blockSize, std::align_val_t{CACHE_LINE_SIZE}))},
+				blockSize});
+			m_block = m_blocks.size() - 1;
+			m_offset = bytes;
+			return m_blocks.back().data.get();
+		}
+
+		std::size_t m_firstBlockSize;
+		std::vector<Block> m_blocks;
+		std::size_t m_block{0};
+		std::size_t m_offset{0};
+	};
+
+	// Arena of calling thread, library algorithms use it when no arena is passed to them
+	[[nodiscard]] inline ScratchArena &ThreadScratchArena() noexcept
+	{
+		static thread_local ScratchArena arena;
+		return arena;
+	}
+
+	// Allocator over arena, lets matrixes live in scratch memory. Deallocation does nothing,
+	// memory is returned when enclosing scope of arena is closed
+	template<typename T>
+	class ScratchAllocator
+	{
+	public:
+		using value_type = T;
+
+		explicit ScratchAllocator(ScratchArena &arena) noexcept :
+			m_arena{&arena}
+		{}
+
+		template<typename U>
+		ScratchAllocator(const ScratchAllocator<U> &other) noexcept :
+			m_arena{&other.Arena()}
+		{}
+
+		[[nodiscard]] T *allocate(std::size_t count)
+		{
+			return m_arena->Allocate<T>(count);
+		}
+
+		void deallocate(T * /*unused*/, std::size_t /*unused*/) noexcept {}
+
+		[[nodiscard]] inline ScratchArena &Arena() const noexcept { return *m_arena; }
+
+		template<typename U>
+		[[nodiscard]] bool operator==(const ScratchAllocator<U> &other) const noexcept
+		{
+			return m_arena == &other.Arena();
+		}
+
+	private:
+		ScratchArena *m_arena;
+	};
+}
+
+#endif // MATRIX_SCRATCH_ARENA_H
@@ -0,0 +1,284 @@
+#ifndef MATRIX_SERIALIZATION_H
+#define MATRIX_SERIALIZATION_H
+
+#include <algorithm>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+#include "allocator.h"
+#include "matrix.h"
+#include "mapped_matrix.h"
+
+namespace MxLib
+{
+	// Binary matrix file is 64 bytes header followed by elements stored row by row without padding.
+	// Elements start at cache line boundary, so file can be mapped as MappedMatrix without copying
+	enum class ElementType : std::uint32_t
+	{
+		Int8 = 1,
+		UInt8,
+		Int16,
+		UInt16,
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Float32,
+		Float64
+	};
+
+	template<typename T>
+	concept SerializableT = std::is_arithmetic_v<T> && !std::same_as<T, bool> &&
+		(std::integral<T> || sizeof(T) == 4 || sizeof(T) == 8);
+
+	struct MatrixFileHeader
+	{
+		static inline constexpr const char MAGIC[8]{'M', 'A', 'T', 'H', 'X', 'M', 'A', 'T'};
+		static inline constexpr const std::uint32_t VERSION{1};
+		// Written in native byte order, so files of other byte order don't match it
+		static inline constexpr const std::uint32_t BYTE_ORDER_MARK{0x01020304};
+
+		char magic[8];
+		std::uint32_t version;
+		std::uint32_t byteOrder;
+		ElementType elementType;
+		std::uint32_t elementSize;
+		std::uint64_t rows;
+		std::uint64_t cols;
+		// Position of first element from beginning of file and its alignment
+		std::uint64_t dataOffset;
+		std::uint64_t dataAlignment;
+		std::uint8_t reserved[8];
+	};
+	static_assert(sizeof(MatrixFileHeader) == CACHE_LINE_SIZE, "Header should take exactly one cache line");
+	static_assert(std::is_trivially_copyable_v<MatrixFileHeader>);
+
+	template<SerializableT T>
+	[[nodiscard]] consteval ElementType ElementTypeOf() noexcept
+	{
+		if constexpr (std::floating_point<T>)
+		{
+			return sizeof(T) == 4 ? ElementType::Float32 : ElementType::Float64;
+		}
+		else
+		{
+			constexpr ElementType SIGNED[]{ElementType::Int8, ElementType::Int16, ElementType::Int32, ElementType::Int64};
+			constexpr ElementType UNSIGNED[]{ElementType::UInt8, ElementType::UInt16, ElementType::UInt32, ElementType::UInt64};
+			constexpr std::size_t SIZE_INDEX = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 3;
+			return std::is_signed_v<T> ? SIGNED[SIZE_INDEX] : UNSIGNED[SIZE_INDEX];
+		}
+	}
+
+	namespace detail
+	{
+		// Elements that aren't stored continuously are gathered into buffers of this size before being written
+		static inline constexpr const std::size_t SERIALIZATION_CHUNK_BYTES{std::size_t{1} << 20};
+
+		// Whole matrix is passed in single call when possible, so transfers run at disk speed
+		inline void WriteAll(int descriptor, const void *data, std::size_t bytes, const std::filesystem::path &path)
+		{
+			const auto *position = static_cast<const std::byte *>(data);
+			while (bytes > 0)
+			{
+				const ssize_t written = ::write(descriptor, position, bytes);
+				if (written < 0)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+					ThrowSystemError(path, "write");
+				}
+				position += written;
+				bytes -= static_cast<std::size_t>(written);
+			}
+		}
+
+		inline void ReadAll(int descriptor, void *data, std::size_t bytes, std::uint64_t offset, const std::filesystem::path &path)
+		{
+			auto *position = static_cast<std::byte *>(data);
+			while (bytes > 0)
+			{
+				const ssize_t read = ::pread(descriptor, position, bytes, static_cast<off_t>(offset));
+				if (read < 0)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+					ThrowSystemError(path, "read");
+				}
+				if (read == 0)
+				{
+					throw std::runtime_error{fmt::format("File {} ends before matrix data", path.string())};
+				}
+				position += read;
+				offset += static_cast<std::uint64_t>(read);
+				bytes -= static_cast<std::size_t>(read);
+			}
+		}
+
+		template<SerializableT T>
+		[[nodiscard]] MatrixFileHeader MakeHeader(std::size_t rows, std::size_t cols) noexcept
+		{
+			MatrixFileHeader header{};
+			std::memcpy(header.magic, MatrixFileHeader::MAGIC, sizeof(header.magic));
+			header.version = MatrixFileHeader::VERSION;
+			header.byteOrder = MatrixFileHeader::BYTE_ORDER_MARK;
+			header.elementType = ElementTypeOf<T>();
+			header.elementSize = sizeof(T);
+			header.rows = rows;
+			header.cols = cols;
+			header.dataOffset = sizeof(MatrixFileHeader);
+			header.dataAlignment = CACHE_LINE_SIZE;
+			return header;
+		}
+
+		// Checks that file holds matrix of T and is big enough for all its elements
+		template<SerializableT T>
+		[[nodiscard]] MatrixFileHeader ReadHeader(int descriptor, const std::filesystem::path &path)
+		{
+			MatrixFileHeader header{};
+			ReadAll(descriptor, &header, sizeof(header), 0, path);
+			if (std::memcmp(header.magic, MatrixFileHeader::MAGIC, sizeof(header.magic)) != 0)
+			{
+				throw std::runtime_error{fmt::format("File {} is not a matrix file", path.string())};
+			}
+			if (header.version != MatrixFileHeader::VERSION || header.byteOrder != MatrixFileHeader::BYTE_ORDER_MARK)
+			{
+				throw std::runtime_error{fmt::format("Matrix file {} has unsupported version {} or byte order {:#x}",
+					path.string(), header.version, header.byteOrder)};
+			}
+			if (header.elementType != ElementTypeOf<T>() || header.elementSize != sizeof(T))
+			{
+				throw std::runtime_error{fmt::format("Matrix file {} stores elements of type {}, but {} was requested",
+					path.string(), static_cast<std::uint32_t>(header.elementType),
+					static_cast<std::uint32_t>(ElementTypeOf<T>()))};
+			}
+
+			struct stat status{};
+			if (::fstat(descriptor, &status) != 0)
+			{
+				ThrowSystemError(path, "read size of");
+			}
+			// Compared by division, so dimensions of damaged header don't overflow
+			const auto fileSize = static_cast<std::uint64_t>(status.st_size);
+			const std::uint64_t capacity = fileSize < header.dataOffset ? 0 : (fileSize - header.dataOffset) / sizeof(T);
+			if (header.cols != 0 && header.rows > capacity / header.cols)
+			{
+				throw std::length_error{fmt::format("Matrix file {} of {} bytes is too small for {}x{} matrix",
+					path.string(), status.st_size, header.rows, header.cols)};
+			}
+			return header;
+		}
+	}
+
+	// Writes matrix as binary matrix file, existing file is replaced
+	template<ReadonlyMatrixT M>
+		requires SerializableT<typename M::contained>
+	void Save(const std::filesystem::path &path, const M &matrix)
+	{
+		using T = typename M::contained;
+
+		const detail::FileDescriptor file{path, O_WRONLY | O_CREAT | O_TRUNC, 0644};
+		const MatrixFileHeader header = detail::MakeHeader<T>(matrix.Rows(), matrix.Cols());
+		detail::WriteAll(file.Get(), &header, sizeof(header), path);
+
+		if constexpr (StridedStorageMatrix<M>)
+		{
+			if (matrix.ColStride() == 1 && matrix.RowStride() == matrix.Cols())
+			{
+				detail::WriteAll(file.Get(), matrix.data(), matrix.Rows() * matrix.Cols() * sizeof(T), path);
+				return;
+			}
+		}
+
+		// Padded or strided rows and matrixes without storage are gathered into chunks of whole rows
+		const std::size_t chunkRows = std::max<std::size_t>(detail::SERIALIZATION_CHUNK_BYTES / sizeof(T) / std::max<std::size_t>(matrix.Cols(), 1), 1);
+		std::vector<T> chunk(std::min(chunkRows, matrix.Rows()) * matrix.Cols());
+		for (std::size_t chunkStart = 0; chunkStart < matrix.Rows(); chunkStart += chunkRows)
+		{
+			const std::size_t chunkEnd = std::min(chunkStart + chunkRows, matrix.Rows());
+			T *out = chunk.data();
+			for (std::size_t row = chunkStart; row < chunkEnd; ++row)
+			{
+				for (std::size_t col = 0; col < matrix.Cols(); ++col)
+				{
+					*out++ = UncheckedAt(matrix, row, col);
+				}
+			}
+			detail::WriteAll(file.Get(), chunk.data(), (chunkEnd - chunkStart) * matrix.Cols() * sizeof(T), path);
+		}
+	}
+
+	// Reads binary matrix file into new matrix, static matrixes should have the same dimensions as stored one
+	template<ContinuousStorageMatrix M>
+		requires SerializableT<typename M::contained>
+	[[nodiscard]] M Load(const std::filesystem::path &path)
+	{
+		using T = typename M::contained;
+
+		const detail::FileDescriptor file{path, O_RDONLY};
+		const MatrixFileHeader header = detail::ReadHeader<T>(file.Get(), path);
+		const auto rows = static_cast<std::size_t>(header.rows);
+		const auto cols = static_cast<std::size_t>(header.cols);
+		if constexpr (StaticMatrixT<M>)
+		{
+			if (rows != M::ROWS || cols != M::COLS)
+			{
+				throw std::length_error{fmt::format("Matrix file {} stores {}x{} matrix, but {}x{} was requested",
+					path.string(), rows, cols, M::ROWS, M::COLS)};
+			}
+		}
+		::posix_fadvise(file.Get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+
+		auto matrix{MatrixConstructor<M>::Create(rows, cols)};
+		const std::size_t rowStride = RowStrideOf(matrix);
+		if (rowStride == cols)
+		{
+			detail::ReadAll(file.Get(), matrix.data(), rows * cols * sizeof(T), header.dataOffset, path);
+			return matrix;
+		}
+
+		// Padded rows are read in chunks of whole rows and placed at their strides
+		const std::size_t chunkRows = std::max<std::size_t>(detail::SERIALIZATION_CHUNK_BYTES / sizeof(T) / std::max<std::size_t>(cols, 1), 1);
+		std::vector<T> chunk(std::min(chunkRows, rows) * cols);
+		for (std::size_t chunkStart = 0; chunkStart < rows; chunkStart += chunkRows)
+		{
+			const std::size_t chunkEnd = std::min(chunkStart + chunkRows, rows);
+			detail::ReadAll(file.Get(), chunk.data(), (chunkEnd - chunkStart) * cols * sizeof(T),
+				header.dataOffset + chunkStart * cols * sizeof(T), path);
+			for (std::size_t row = chunkStart; row < chunkEnd; ++row)
+			{
+				std::copy_n(chunk.data() + (row - chunkStart) * cols, cols, matrix.data() + row * rowStride);
+			}
+		}
+		return matrix;
+	}
+
+	// Maps elements of binary matrix file in place, nothing is read until elements are accessed
+	template<SerializableT T>
+	[[nodiscard]] MappedMatrix<T> LoadMapped(const std::filesystem::path &path, MapMode mode = MapMode::ReadOnly)
+	{
+		const detail::FileDescriptor file{path, O_RDONLY};
+		const MatrixFileHeader header = detail::ReadHeader<T>(file.Get(), path);
+		return MappedMatrix<T>{path, static_cast<std::size_t>(header.rows), static_cast<std::size_t>(header.cols),
+			mode, static_cast<std::size_t>(header.dataOffset)};
+	}
+}
+
+#endif // MATRIX_SERIALIZATION_H
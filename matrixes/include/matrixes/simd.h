@@ -0,0 +1,701 @@
+#ifndef MATRIX_SIMD_H
+#define MATRIX_SIMD_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+// Vectorized kernels are written with GNU vector extensions, __builtin_shufflevector takes
+// clang or GCC 12. Other compilers, like MSVC, use scalar kernels only
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12)
+	#define MATHX_SIMD_VECTORS 1
+#else
+	#define MATHX_SIMD_VECTORS 0
+#endif
+
+// Kernels for several x86 targets are compiled by gnu::target and picked at runtime
+#if MATHX_SIMD_VECTORS && (defined(__x86_64__) || defined(__i386__))
+	#define MATHX_SIMD_X86 1
+#else
+	#define MATHX_SIMD_X86 0
+#endif
+
+namespace MxLib::simd
+{
+	// Instruction sets with dedicated kernels, ordered from the least to the most capable
+	enum class Isa
+	{
+		Scalar,
+		SSE42,
+		AVX2,
+		AVX512
+	};
+
+	template<typename T>
+	concept SimdSupported = std::same_as<T, float> || std::same_as<T, double>;
+
+	// Side of square block transposed by transposeTile kernel
+	static inline constexpr const std::size_t TRANSPOSE_TILE{8};
+
+	// Every element of output depends only on elements with the same index, so out can be lhs
+	template<typename T>
+	struct Kernels
+	{
+		void (*add)(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept;
+		void (*subtract)(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept;
+		void (*multiply)(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept;
+		void (*divide)(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept;
+
+		void (*addScalar)(const T *lhs, T rhs, T *out, std::size_t count) noexcept;
+		void (*subtractScalar)(const T *lhs, T rhs, T *out, std::size_t count) noexcept;
+		void (*multiplyScalar)(const T *lhs, T rhs, T *out, std::size_t count) noexcept;
+		void (*divideScalar)(const T *lhs, T rhs, T *out, std::size_t count) noexcept;
+
+		T (*dot)(const T *lhs, const T *rhs, std::size_t count) noexcept;
+
+		// Writes transpose of TRANSPOSE_TILE x TRANSPOSE_TILE block of in to out, blocks should not overlap
+		void (*transposeTile)(const T *in, std::size_t inRowStride, T *out, std::size_t outRowStride) noexcept;
+	};
+
+	// Computes rows x cols tile of C from MR rows packed A panel and NR cols packed B panel
+	template<typename T>
+	using MicroKernelFunc = void (*)(std::size_t kc, const T *packedA, const T *packedB,
+		T *c, std::size_t cRowStride, std::size_t rows, std::size_t cols, bool accumulate) noexcept;
+
+	// Computes products of count pairs of small matrixes stored as structure of arrays, element (row, col)
+	// of every matrix lies in its own lane and lanes of one batch are laneStride elements apart
+	template<typename T>
+	using BatchProductFunc = void (*)(const T *lhs, const T *rhs, T *out, std::size_t laneStride, std::size_t count) noexcept;
+
+	namespace detail
+	{
+		// Operations update left operand in place, so wide vectors are never passed
+		// by value between functions compiled for different targets
+		struct AddOp
+		{
+			template<typename V>
+			[[gnu::always_inline]] static inline void Apply(V &lhs, const V &rhs) noexcept { lhs += rhs; }
+		};
+		struct SubtractOp
+		{
+			template<typename V>
+			[[gnu::always_inline]] static inline void Apply(V &lhs, const V &rhs) noexcept { lhs -= rhs; }
+		};
+		struct MultiplyOp
+		{
+			template<typename V>
+			[[gnu::always_inline]] static inline void Apply(V &lhs, const V &rhs) noexcept { lhs *= rhs; }
+		};
+		struct DivideOp
+		{
+			template<typename V>
+			[[gnu::always_inline]] static inline void Apply(V &lhs, const V &rhs) noexcept { lhs /= rhs; }
+		};
+
+		template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+		inline void BatchProductScalar(const T *lhs, const T *rhs, T *out, std::size_t laneStride,
+			std::size_t begin, std::size_t end) noexcept
+		{
+			for (std::size_t index = begin; index < end; ++index)
+			{
+				for (std::size_t row = 0; row < ROWS; ++row)
+				{
+					for (std::size_t col = 0; col < COLS; ++col)
+					{
+						T sum{};
+						for (std::size_t iter = 0; iter < INNER; ++iter)
+						{
+							sum += lhs[(row * INNER + iter) * laneStride + index] * rhs[(iter * COLS + col) * laneStride + index];
+						}
+						out[(row * COLS + col) * laneStride + index] = sum;
+					}
+				}
+			}
+		}
+
+#if MATHX_SIMD_VECTORS
+		// Generic vector type of given width in bytes, operations on it are lowered
+		// to instructions of the target selected by function they are inlined into
+		template<typename T, std::size_t Bytes>
+		struct Vector
+		{
+			typedef T type __attribute__((vector_size(Bytes)));
+			static constexpr std::size_t WIDTH = Bytes / sizeof(T);
+
+			[[gnu::always_inline]] static inline void Load(type &to, const T *from) noexcept
+			{
+				std::memcpy(&to, from, Bytes);
+			}
+
+			[[gnu::always_inline]] static inline void Store(T *to, const type &value) noexcept
+			{
+				std::memcpy(to, &value, Bytes);
+			}
+
+			[[gnu::always_inline]] static inline void Broadcast(type &to, T value) noexcept
+			{
+				to = type{} + value;
+			}
+		};
+
+		template<typename T, std::size_t Bytes, typename Op>
+		[[gnu::always_inline]] inline void Binary(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept
+		{
+			using V = Vector<T, Bytes>;
+
+			std::size_t index = 0;
+			for (; index + V::WIDTH <= count; index += V::WIDTH)
+			{
+				typename V::type value;
+				typename V::type other;
+				V::Load(value, lhs + index);
+				V::Load(other, rhs + index);
+				Op::Apply(value, other);
+				V::Store(out + index, value);
+			}
+			for (; index < count; ++index)
+			{
+				T value{lhs[index]};
+				Op::Apply(value, rhs[index]);
+				out[index] = value;
+			}
+		}
+
+		template<typename T, std::size_t Bytes, typename Op>
+		[[gnu::always_inline]] inline void BinaryScalar(const T *lhs, T rhs, T *out, std::size_t count) noexcept
+		{
+			using V = Vector<T, Bytes>;
+
+			typename V::type broadcasted;
+			V::Broadcast(broadcasted, rhs);
+			std::size_t index = 0;
+			for (; index + V::WIDTH <= count; index += V::WIDTH)
+			{
+				typename V::type value;
+				V::Load(value, lhs + index);
+				Op::Apply(value, broadcasted);
+				V::Store(out + index, value);
+			}
+			for (; index < count; ++index)
+			{
+				T value{lhs[index]};
+				Op::Apply(value, rhs);
+				out[index] = value;
+			}
+		}
+
+		template<typename T, std::size_t Bytes>
+		[[gnu::always_inline]] inline T Dot(const T *lhs, const T *rhs, std::size_t count) noexcept
+		{
+			using V = Vector<T, Bytes>;
+
+			// Two independent accumulators hide latency of multiply-add chain
+			typename V::type first{};
+			typename V::type second{};
+			typename V::type lValue;
+			typename V::type rValue;
+			std::size_t index = 0;
+			for (; index + 2 * V::WIDTH <= count; index += 2 * V::WIDTH)
+			{
+				V::Load(lValue, lhs + index);
+				V::Load(rValue, rhs + index);
+				first += lValue * rValue;
+				V::Load(lValue, lhs + index + V::WIDTH);
+				V::Load(rValue, rhs + index + V::WIDTH);
+				second += lValue * rValue;
+			}
+			for (; index + V::WIDTH <= count; index += V::WIDTH)
+			{
+				V::Load(lValue, lhs + index);
+				V::Load(rValue, rhs + index);
+				first += lValue * rValue;
+			}
+			first += second;
+
+			T result{};
+			for (std::size_t lane = 0; lane < V::WIDTH; ++lane)
+			{
+				result += first[lane];
+			}
+			for (; index < count; ++index)
+			{
+				result += lhs[index] * rhs[index];
+			}
+			return result;
+		}
+
+		// Indexes of lanes taken from two vectors of WIDTH lanes by interleaving their low or high halves
+		template<std::size_t WIDTH, bool HIGH>
+		struct InterleaveIndexes
+		{
+			static constexpr std::size_t Lane(std::size_t lane) noexcept
+			{
+				return (lane % 2 == 0 ? 0 : WIDTH) + (HIGH ? WIDTH / 2 : 0) + lane / 2;
+			}
+		};
+
+		// Result is written through reference, like in other helpers, so wide vector is never returned by value
+		template<typename V, bool HIGH, std::size_t... Lanes>
+		[[gnu::always_inline]] inline void Interleave(typename V::type &out, const typename V::type &lhs,
+			const typename V::type &rhs, std::index_sequence<Lanes...> /*unused*/) noexcept
+		{
+			out = __builtin_shufflevector(lhs, rhs, InterleaveIndexes<V::WIDTH, HIGH>::Lane(Lanes)...);
+		}
+
+		// One round of register transpose, row i is interleaved with row i + WIDTH / 2. Rows are
+		// expanded from index sequence, so blocks stay in registers instead of indexed stack arrays
+		template<typename V, std::size_t... Rows>
+		[[gnu::always_inline]] inline void InterleaveRound(typename V::type (&rows)[V::WIDTH],
+			std::index_sequence<Rows...> /*unused*/) noexcept
+		{
+			constexpr std::size_t HALF = V::WIDTH / 2;
+			typename V::type interleaved[V::WIDTH];
+			((Interleave<V, false>(interleaved[2 * Rows], rows[Rows], rows[Rows + HALF], std::make_index_sequence<V::WIDTH>{}),
+				Interleave<V, true>(interleaved[2 * Rows + 1], rows[Rows], rows[Rows + HALF], std::make_index_sequence<V::WIDTH>{})), ...);
+			((rows[2 * Rows] = interleaved[2 * Rows], rows[2 * Rows + 1] = interleaved[2 * Rows + 1]), ...);
+		}
+
+		// Transposes WIDTH x WIDTH block in registers, after log2(WIDTH) interleaving rounds
+		// rows hold columns of the block
+		template<typename T, std::size_t Bytes, std::size_t... Rows>
+		[[gnu::always_inline]] inline void TransposeRegisters(const T *in, std::size_t inRowStride,
+			T *out, std::size_t outRowStride, std::index_sequence<Rows...> /*unused*/) noexcept
+		{
+			using V = Vector<T, Bytes>;
+			constexpr std::size_t WIDTH = V::WIDTH;
+			static_assert(WIDTH >= 2 && (WIDTH & (WIDTH - 1)) == 0, "Vector width should be a power of 2");
+
+			typename V::type rows[WIDTH];
+			(V::Load(rows[Rows], in + Rows * inRowStride), ...);
+			// Round count is log2(WIDTH), it is at most 4 for any vector wider than 2 lanes
+			InterleaveRound<V>(rows, std::make_index_sequence<WIDTH / 2>{});
+			if constexpr (WIDTH >= 4)
+			{
+				InterleaveRound<V>(rows, std::make_index_sequence<WIDTH / 2>{});
+			}
+			if constexpr (WIDTH >= 8)
+			{
+				InterleaveRound<V>(rows, std::make_index_sequence<WIDTH / 2>{});
+			}
+			if constexpr (WIDTH >= 16)
+			{
+				InterleaveRound<V>(rows, std::make_index_sequence<WIDTH / 2>{});
+			}
+			static_assert(WIDTH <= 16, "Vector width is limited by the number of rounds above");
+			(V::Store(out + Rows * outRowStride, rows[Rows]), ...);
+		}
+
+		// Tile is split into square blocks of vector width, widest vectors are not wider than tile
+		template<typename T, std::size_t Bytes>
+		[[gnu::always_inline]] inline void TransposeTile(const T *in, std::size_t inRowStride,
+			T *out, std::size_t outRowStride) noexcept
+		{
+			constexpr std::size_t BLOCK_BYTES = std::min(Bytes, TRANSPOSE_TILE * sizeof(T));
+			constexpr std::size_t BLOCK = BLOCK_BYTES / sizeof(T);
+			for (std::size_t row = 0; row < TRANSPOSE_TILE; row += BLOCK)
+			{
+				for (std::size_t col = 0; col < TRANSPOSE_TILE; col += BLOCK)
+				{
+					TransposeRegisters<T, BLOCK_BYTES>(in + row * inRowStride + col, inRowStride,
+						out + col * outRowStride + row, outRowStride, std::make_index_sequence<BLOCK>{});
+				}
+			}
+		}
+
+		template<typename V, typename T, std::size_t... Lanes>
+		[[gnu::always_inline]] inline void LoadLanes(typename V::type *to, const T *from, std::size_t laneStride,
+			std::index_sequence<Lanes...> /*unused*/) noexcept
+		{
+			(V::Load(to[Lanes], from + Lanes * laneStride), ...);
+		}
+
+		template<typename V, std::size_t INNER, std::size_t COLS, typename T, std::size_t... Iter>
+		[[gnu::always_inline]] inline void BatchDot(typename V::type &sum, const typename V::type *lhsRow,
+			const T *rhs, std::size_t laneStride, std::index_sequence<Iter...> /*unused*/) noexcept
+		{
+			typename V::type rhsCol[INNER];
+			LoadLanes<V>(rhsCol, rhs, COLS * laneStride, std::index_sequence<Iter...>{});
+			sum = ((lhsRow[Iter] * rhsCol[Iter]) + ...);
+		}
+
+		// Row of products for WIDTH pairs of matrixes, row of left matrixes is loaded once for all columns
+		template<typename V, std::size_t INNER, std::size_t COLS, typename T, std::size_t... Cols>
+		[[gnu::always_inline]] inline void BatchProductRow(const T *lhs, const T *rhs, T *out, std::size_t laneStride,
+			std::index_sequence<Cols...> /*unused*/) noexcept
+		{
+			typename V::type lhsRow[INNER];
+			LoadLanes<V>(lhsRow, lhs, laneStride, std::make_index_sequence<INNER>{});
+			typename V::type sum;
+			((BatchDot<V, INNER, COLS>(sum, lhsRow, rhs + Cols * laneStride, laneStride, std::make_index_sequence<INNER>{}),
+				V::Store(out + Cols * laneStride, sum)), ...);
+		}
+
+		// Every vector holds the same element of WIDTH matrixes, so tiny products are done
+		// for WIDTH matrixes at once without any shuffles
+		template<typename T, std::size_t Bytes, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+		[[gnu::always_inline]] inline void BatchProduct(const T *lhs, const T *rhs, T *out, std::size_t laneStride,
+			std::size_t count) noexcept
+		{
+			using V = Vector<T, Bytes>;
+
+			std::size_t index = 0;
+			for (; index + V::WIDTH <= count; index += V::WIDTH)
+			{
+				for (std::size_t row = 0; row < ROWS; ++row)
+				{
+					BatchProductRow<V, INNER, COLS>(lhs + row * INNER * laneStride + index, rhs + index,
+						out + row * COLS * laneStride + index, laneStride, std::make_index_sequence<COLS>{});
+				}
+			}
+			BatchProductScalar<T, ROWS, INNER, COLS>(lhs, rhs, out, laneStride, index, count);
+		}
+
+		template<typename T, std::size_t Bytes, std::size_t MR, std::size_t NR>
+		[[gnu::always_inline]] inline void MicroKernel(std::size_t kc, const T *packedA, const T *packedB,
+			T *c, std::size_t cRowStride, std::size_t rows, std::size_t cols, bool accumulate) noexcept
+		{
+			using V = Vector<T, Bytes>;
+			constexpr std::size_t VECTORS = NR / V::WIDTH;
+			static_assert(NR % V::WIDTH == 0, "Register tile width should be multiple of vector width");
+
+			typename V::type accumulators[MR][VECTORS]{};
+			typename V::type bValues[VECTORS];
+			typename V::type aValue;
+			for (std::size_t iter = 0; iter < kc; ++iter)
+			{
+				for (std::size_t vec = 0; vec < VECTORS; ++vec)
+				{
+					V::Load(bValues[vec], packedB + vec * V::WIDTH);
+				}
+				for (std::size_t row = 0; row < MR; ++row)
+				{
+					V::Broadcast(aValue, packedA[row]);
+					for (std::size_t vec = 0; vec < VECTORS; ++vec)
+					{
+						accumulators[row][vec] += aValue * bValues[vec];
+					}
+				}
+				packedA += MR;
+				packedB += NR;
+			}
+
+			if (rows == MR && cols == NR)
+			{
+				for (std::size_t row = 0; row < MR; ++row)
+				{
+					T *cRow = c + row * cRowStride;
+					for (std::size_t vec = 0; vec < VECTORS; ++vec)
+					{
+						if (accumulate)
+						{
+							V::Load(bValues[vec], cRow + vec * V::WIDTH);
+							accumulators[row][vec] += bValues[vec];
+						}
+						V::Store(cRow + vec * V::WIDTH, accumulators[row][vec]);
+					}
+				}
+				return;
+			}
+
+			T tile[MR][NR];
+			std::memcpy(tile, accumulators, sizeof(tile));
+			for (std::size_t row = 0; row < rows; ++row)
+			{
+				T *cRow = c + row * cRowStride;
+				for (std::size_t col = 0; col < cols; ++col)
+				{
+					cRow[col] = accumulate ? cRow[col] + tile[row][col] : tile[row][col];
+				}
+			}
+		}
+#endif
+	}
+
+	// Reference implementation, used on CPUs without supported vector extensions
+	// and as an oracle for vectorized kernels
+	namespace scalar
+	{
+		template<typename T, typename Op>
+		void Binary(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				T value{lhs[index]};
+				Op::Apply(value, rhs[index]);
+				out[index] = value;
+			}
+		}
+
+		template<typename T, typename Op>
+		void BinaryScalar(const T *lhs, T rhs, T *out, std::size_t count) noexcept
+		{
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				T value{lhs[index]};
+				Op::Apply(value, rhs);
+				out[index] = value;
+			}
+		}
+
+		template<typename T>
+		T Dot(const T *lhs, const T *rhs, std::size_t count) noexcept
+		{
+			T result{};
+			for (std::size_t index = 0; index < count; ++index)
+			{
+				result += lhs[index] * rhs[index];
+			}
+			return result;
+		}
+
+		template<typename T>
+		void TransposeTile(const T *in, std::size_t inRowStride, T *out, std::size_t outRowStride) noexcept
+		{
+			for (std::size_t row = 0; row < TRANSPOSE_TILE; ++row)
+			{
+				for (std::size_t col = 0; col < TRANSPOSE_TILE; ++col)
+				{
+					out[col * outRowStride + row] = in[row * inRowStride + col];
+				}
+			}
+		}
+
+		template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+		void BatchProduct(const T *lhs, const T *rhs, T *out, std::size_t laneStride, std::size_t count) noexcept
+		{
+			detail::BatchProductScalar<T, ROWS, INNER, COLS>(lhs, rhs, out, laneStride, 0, count);
+		}
+
+		template<typename T, std::size_t MR, std::size_t NR>
+		void MicroKernel(std::size_t kc, const T *packedA, const T *packedB,
+			T *c, std::size_t cRowStride, std::size_t rows, std::size_t cols, bool accumulate) noexcept
+		{
+			T accumulators[MR][NR]{};
+			for (std::size_t iter = 0; iter < kc; ++iter)
+			{
+				for (std::size_t row = 0; row < MR; ++row)
+				{
+					const T aValue = packedA[row];
+					for (std::size_t col = 0; col < NR; ++col)
+					{
+						accumulators[row][col] += aValue * packedB[col];
+					}
+				}
+				packedA += MR;
+				packedB += NR;
+			}
+
+			for (std::size_t row = 0; row < rows; ++row)
+			{
+				T *cRow = c + row * cRowStride;
+				for (std::size_t col = 0; col < cols; ++col)
+				{
+					cRow[col] = accumulate ? cRow[col] + accumulators[row][col] : accumulators[row][col];
+				}
+			}
+		}
+	}
+
+#if MATHX_SIMD_X86
+	#define MATHX_DEFINE_SIMD_KERNELS(TARGET, BYTES) \
+		template<typename T, typename Op> \
+		[[gnu::target(TARGET)]] void Binary(const T *lhs, const T *rhs, T *out, std::size_t count) noexcept \
+		{ \
+			detail::Binary<T, BYTES, Op>(lhs, rhs, out, count); \
+		} \
+		template<typename T, typename Op> \
+		[[gnu::target(TARGET)]] void BinaryScalar(const T *lhs, T rhs, T *out, std::size_t count) noexcept \
+		{ \
+			detail::BinaryScalar<T, BYTES, Op>(lhs, rhs, out, count); \
+		} \
+		template<typename T> \
+		[[gnu::target(TARGET)]] T Dot(const T *lhs, const T *rhs, std::size_t count) noexcept \
+		{ \
+			return detail::Dot<T, BYTES>(lhs, rhs, count); \
+		} \
+		template<typename T> \
+		[[gnu::target(TARGET)]] void TransposeTile(const T *in, std::size_t inRowStride, \
+			T *out, std::size_t outRowStride) noexcept \
+		{ \
+			detail::TransposeTile<T, BYTES>(in, inRowStride, out, outRowStride); \
+		} \
+		template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS> \
+		[[gnu::target(TARGET)]] void BatchProduct(const T *lhs, const T *rhs, T *out, std::size_t laneStride, \
+			std::size_t count) noexcept \
+		{ \
+			detail::BatchProduct<T, BYTES, ROWS, INNER, COLS>(lhs, rhs, out, laneStride, count); \
+		} \
+		template<typename T, std::size_t MR, std::size_t NR> \
+		[[gnu::target(TARGET)]] void MicroKernel(std::size_t kc, const T *packedA, const T *packedB, \
+			T *c, std::size_t cRowStride, std::size_t rows, std::size_t cols, bool accumulate) noexcept \
+		{ \
+			detail::MicroKernel<T, BYTES, MR, NR>(kc, packedA, packedB, c, cRowStride, rows, cols, accumulate); \
+		}
+
+	namespace sse42
+	{
+		MATHX_DEFINE_SIMD_KERNELS("sse4.2", 16)
+	}
+	namespace avx2
+	{
+		MATHX_DEFINE_SIMD_KERNELS("avx2,fma", 32)
+	}
+	namespace avx512
+	{
+		MATHX_DEFINE_SIMD_KERNELS("avx512f,avx2,fma", 64)
+	}
+
+	#undef MATHX_DEFINE_SIMD_KERNELS
+#endif
+
+	// Queries CPUID for the most capable instruction set supported by current CPU and OS
+	[[nodiscard]] inline Isa DetectIsa() noexcept
+	{
+#if MATHX_SIMD_X86
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		{
+			return Isa::AVX512;
+		}
+		if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		{
+			return Isa::AVX2;
+		}
+		if (__builtin_cpu_supports("sse4.2"))
+		{
+			return Isa::SSE42;
+		}
+#endif
+		return Isa::Scalar;
+	}
+
+	// Instruction set that is used by library, detected once on first use
+	[[nodiscard]] inline Isa ActiveIsa() noexcept
+	{
+		static const Isa activeIsa{DetectIsa()};
+		return activeIsa;
+	}
+
+	template<SimdSupported T>
+	[[nodiscard]] const Kernels<T> &GetKernels(Isa isa) noexcept
+	{
+		static constexpr const Kernels<T> scalarKernels{
+			scalar::Binary<T, detail::AddOp>,
+			scalar::Binary<T, detail::SubtractOp>,
+			scalar::Binary<T, detail::MultiplyOp>,
+			scalar::Binary<T, detail::DivideOp>,
+			scalar::BinaryScalar<T, detail::AddOp>,
+			scalar::BinaryScalar<T, detail::SubtractOp>,
+			scalar::BinaryScalar<T, detail::MultiplyOp>,
+			scalar::BinaryScalar<T, detail::DivideOp>,
+			scalar::Dot<T>,
+			scalar::TransposeTile<T>
+		};
+#if MATHX_SIMD_X86
+		static constexpr const Kernels<T> sse42Kernels{
+			sse42::Binary<T, detail::AddOp>,
+			sse42::Binary<T, detail::SubtractOp>,
+			sse42::Binary<T, detail::MultiplyOp>,
+			sse42::Binary<T, detail::DivideOp>,
+			sse42::BinaryScalar<T, detail::AddOp>,
+			sse42::BinaryScalar<T, detail::SubtractOp>,
+			sse42::BinaryScalar<T, detail::MultiplyOp>,
+			sse42::BinaryScalar<T, detail::DivideOp>,
+			sse42::Dot<T>,
+			sse42::TransposeTile<T>
+		};
+		static constexpr const Kernels<T> avx2Kernels{
+			avx2::Binary<T, detail::AddOp>,
+			avx2::Binary<T, detail::SubtractOp>,
+			avx2::Binary<T, detail::MultiplyOp>,
+			avx2::Binary<T, detail::DivideOp>,
+			avx2::BinaryScalar<T, detail::AddOp>,
+			avx2::BinaryScalar<T, detail::SubtractOp>,
+			avx2::BinaryScalar<T, detail::MultiplyOp>,
+			avx2::BinaryScalar<T, detail::DivideOp>,
+			avx2::Dot<T>,
+			avx2::TransposeTile<T>
+		};
+		static constexpr const Kernels<T> avx512Kernels{
+			avx512::Binary<T, detail::AddOp>,
+			avx512::Binary<T, detail::SubtractOp>,
+			avx512::Binary<T, detail::MultiplyOp>,
+			avx512::Binary<T, detail::DivideOp>,
+			avx512::BinaryScalar<T, detail::AddOp>,
+			avx512::BinaryScalar<T, detail::SubtractOp>,
+			avx512::BinaryScalar<T, detail::MultiplyOp>,
+			avx512::BinaryScalar<T, detail::DivideOp>,
+			avx512::Dot<T>,
+			avx512::TransposeTile<T>
+		};
+
+		switch (isa)
+		{
+			case Isa::AVX512:
+				return avx512Kernels;
+			case Isa::AVX2:
+				return avx2Kernels;
+			case Isa::SSE42:
+				return sse42Kernels;
+			case Isa::Scalar:
+				break;
+		}
+#else
+		(void)isa;
+#endif
+		return scalarKernels;
+	}
+
+	template<SimdSupported T, std::size_t MR, std::size_t NR>
+	[[nodiscard]] MicroKernelFunc<T> GetMicroKernel(Isa isa) noexcept
+	{
+#if MATHX_SIMD_X86
+		switch (isa)
+		{
+			case Isa::AVX512:
+				return avx512::MicroKernel<T, MR, NR>;
+			case Isa::AVX2:
+				return avx2::MicroKernel<T, MR, NR>;
+			case Isa::SSE42:
+				return sse42::MicroKernel<T, MR, NR>;
+			case Isa::Scalar:
+				break;
+		}
+#else
+		(void)isa;
+#endif
+		return scalar::MicroKernel<T, MR, NR>;
+	}
+
+	template<SimdSupported T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+	[[nodiscard]] BatchProductFunc<T> GetBatchProduct(Isa isa) noexcept
+	{
+#if MATHX_SIMD_X86
+		switch (isa)
+		{
+			case Isa::AVX512:
+				return avx512::BatchProduct<T, ROWS, INNER, COLS>;
+			case Isa::AVX2:
+				return avx2::BatchProduct<T, ROWS, INNER, COLS>;
+			case Isa::SSE42:
+				return sse42::BatchProduct<T, ROWS, INNER, COLS>;
+			case Isa::Scalar:
+				break;
+		}
+#else
+		(void)isa;
+#endif
+		return scalar::BatchProduct<T, ROWS, INNER, COLS>;
+	}
+
+	template<SimdSupported T>
+	[[nodiscard]] inline const Kernels<T> &ActiveKernels() noexcept
+	{
+		static const Kernels<T> &activeKernels{GetKernels<T>(ActiveIsa())};
+		return activeKernels;
+	}
+}
+
+#endif // MATRIX_SIMD_H
@@ -0,0 +1,368 @@
+#ifndef MATRIX_SPARSE_MATRIX_H
+#define MATRIX_SPARSE_MATRIX_H
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "allocator.h"
+#include "matrix.h"
+#include "thread_pool.h"
+#include "vector.h"
+
+namespace MxLib
+{
+	// Matrix in compressed sparse row (CSR) format, only non zero elements are stored. Elements of row are
+	// values[rowOffsets[row]...rowOffsets[row + 1]) with columns at the same positions of colIndexes, columns
+	// in row are strictly increasing. Matrix is read only, it is built by SparseMatrixBuilder or from dense one
+	template<typename ContainedT>
+	class SparseMatrix
+	{
+	public:
+		using contained = ContainedT;
+		// Columns are 32 bit, so products read less of index arrays
+		using index_type = std::uint32_t;
+
+		SparseMatrix() = default;
+
+		// Matrix of zeros
+		SparseMatrix(std::size_t rows, std::size_t cols) :
+			m_rows{rows},
+			m_cols{cols},
+			m_rowOffsets(rows + 1, 0)
+		{
+			CheckCols(cols);
+		}
+
+		// Takes ready CSR arrays, they are checked to describe valid matrix
+		SparseMatrix(std::size_t rows, std::size_t cols, std::vector<std::size_t> rowOffsets,
+			std::vector<index_type> colIndexes, std::vector<ContainedT, DefaultAllocator<ContainedT>> values) :
+			m_rows{rows},
+			m_cols{cols},
+			m_rowOffsets{std::move(rowOffsets)},
+			m_colIndexes{std::move(colIndexes)},
+			m_values{std::move(values)}
+		{
+			CheckCols(cols);
+			CheckStructure();
+		}
+
+		// Keeps elements that aren't equal to zero
+		template<ReadonlyMatrixT M>
+			requires std::convertible_to<typename M::contained, ContainedT>
+		[[nodiscard]] static SparseMatrix FromDense(const M &matrix)
+		{
+			SparseMatrix sparse;
+			sparse.m_rows = matrix.Rows();
+			sparse.m_cols = matrix.Cols();
+			CheckCols(sparse.m_cols);
+			// Offset of the first row is already there
+			sparse.m_rowOffsets.reserve(sparse.m_rows + 1);
+			for (std::size_t row = 0; row < sparse.m_rows; ++row)
+			{
+				for (std::size_t col = 0; col < sparse.m_cols; ++col)
+				{
+					const auto value = static_cast<ContainedT>(UncheckedAt(matrix, row, col));
+					if (value != ContainedT{})
+					{
+						sparse.m_colIndexes.push_back(static_cast<index_type>(col));
+						sparse.m_values.push_back(value);
+					}
+				}
+				sparse.m_rowOffsets.push_back(sparse.m_values.size());
+			}
+			return sparse;
+		}
+
+		[[nodiscard]] Matrix<ContainedT> ToDense() const
+		{
+			Matrix<ContainedT> dense{m_rows, m_cols};
+			std::fill_n(dense.data(), dense.size(), ContainedT{});
+			for (std::size_t row = 0; row < m_rows; ++row)
+			{
+				for (std::size_t pos = m_rowOffsets[row]; pos < m_rowOffsets[row + 1]; ++pos)
+				{
+					dense.Unchecked(row, m_colIndexes[pos]) = m_values[pos];
+				}
+			}
+			return dense;
+		}
+
+		[[nodiscard]] constexpr inline std::size_t Cols() const noexcept { return m_cols; }
+		[[nodiscard]] constexpr inline std::size_t Rows() const noexcept { return m_rows; }
+		[[nodiscard]] inline std::size_t NonZeros() const noexcept { return m_values.size(); }
+
+		[[nodiscard]] inline std::span<const std::size_t> RowOffsets() const noexcept { return m_rowOffsets; }
+		[[nodiscard]] inline std::span<const index_type> ColIndexes() const noexcept { return m_colIndexes; }
+		[[nodiscard]] inline std::span<const ContainedT> Values() const noexcept { return m_values; }
+
+		// Element is searched in its row, missing elements are zeros
+		inline const ContainedT &operator()(std::size_t row, std::size_t col) const
+		{
+			CheckBounds(*this, row, col);
+			return Unchecked(row, col);
+		}
+		[[nodiscard]] inline const ContainedT &Unchecked(std::size_t row, std::size_t col) const noexcept
+		{
+			const index_type *rowBegin = m_colIndexes.data() + m_rowOffsets[row];
+			const index_type *rowEnd = m_colIndexes.data() + m_rowOffsets[row + 1];
+			const index_type *found = std::lower_bound(rowBegin, rowEnd, static_cast<index_type>(col));
+			if (found == rowEnd || *found != col)
+			{
+				return ZERO;
+			}
+			return m_values[static_cast<std::size_t>(found - m_colIndexes.data())];
+		}
+
+	private:
+		static inline const ContainedT ZERO{};
+
+		static inline void CheckCols(std::size_t cols)
+		{
+			if (cols > std::numeric_limits<index_type>::max())
+			{
+				throw std::length_error{fmt::format("Sparse matrix cannot have {} cols, columns are 32 bit", cols)};
+			}
+		}
+
+		void CheckStructure() const
+		{
+			if (m_rowOffsets.size() != m_rows + 1 || m_rowOffsets.front() != 0 ||
+				m_rowOffsets.back() != m_values.size() || m_colIndexes.size() != m_values.size())
+			{
+				throw std::invalid_argument{fmt::format("CSR arrays of {} offsets, {} columns and {} values "
+					"don't describe matrix with {} rows", m_rowOffsets.size(), m_colIndexes.size(), m_values.size(), m_rows)};
+			}
+			for (std::size_t row = 0; row < m_rows; ++row)
+			{
+				if (m_rowOffsets[row] > m_rowOffsets[row + 1])
+				{
+					throw std::invalid_argument{fmt::format("Row offsets decrease at row {}", row)};
+				}
+				for (std::size_t pos = m_rowOffsets[row]; pos < m_rowOffsets[row + 1]; ++pos)
+				{
+					if (m_colIndexes[pos] >= m_cols || (pos > m_rowOffsets[row] && m_colIndexes[pos] <= m_colIndexes[pos - 1]))
+					{
+						throw std::invalid_argument{fmt::format("Columns of row {} are out of bounds or not increasing", row)};
+					}
+				}
+			}
+		}
+
+		std::size_t m_rows{0};
+		std::size_t m_cols{0};
+		std::vector<std::size_t> m_rowOffsets{0};
+		std::vector<index_type> m_colIndexes;
+		std::vector<ContainedT, DefaultAllocator<ContainedT>> m_values;
+	};
+
+	// Collects elements in any order, elements added to the same position are summed
+	template<typename ContainedT>
+	class SparseMatrixBuilder
+	{
+	public:
+		SparseMatrixBuilder(std::size_t rows, std::size_t cols) :
+			m_rows{rows},
+			m_cols{cols}
+		{}
+
+		SparseMatrixBuilder &Add(std::size_t row, std::size_t col, const ContainedT &value)
+		{
+			if (row >= m_rows || col >= m_cols)
+			{
+				detail::ThrowOutOfBounds(m_rows, m_cols, row, col);
+			}
+			m_elements.emplace_back(row, col, value);
+			return *this;
+		}
+
+		void Reserve(std::size_t elementsCount)
+		{
+			m_elements.reserve(elementsCount);
+		}
+
+		[[nodiscard]] SparseMatrix<ContainedT> Build() const
+		{
+			using index_type = typename SparseMatrix<ContainedT>::index_type;
+
+			std::vector<Element> sorted{m_elements};
+			std::sort(sorted.begin(), sorted.end(), [](const Element &lhs, const Element &rhs) {
+				return std::tie(std::get<0>(lhs), std::get<1>(lhs)) < std::tie(std::get<0>(rhs), std::get<1>(rhs));
+			});
+
+			std::vector<std::size_t> rowOffsets(m_rows + 1, 0);
+			std::vector<index_type> colIndexes;
+			std::vector<ContainedT, DefaultAllocator<ContainedT>> values;
+			colIndexes.reserve(sorted.size());
+			values.reserve(sorted.size());
+			for (std::size_t pos = 0; pos < sorted.size(); ++pos)
+			{
+				const auto &[row, col, value] = sorted[pos];
+				if (pos > 0 && std::get<0>(sorted[pos - 1]) == row && std::get<1>(sorted[pos - 1]) == col)
+				{
+					values.back() += value;
+					continue;
+				}
+				colIndexes.push_back(static_cast<index_type>(col));
+				values.push_back(value);
+				++rowOffsets[row + 1];
+			}
+			for (std::size_t row = 0; row < m_rows; ++row)
+			{
+				rowOffsets[row + 1] += rowOffsets[row];
+			}
+			return SparseMatrix<ContainedT>{m_rows, m_cols, std::move(rowOffsets), std::move(colIndexes), std::move(values)};
+		}
+
+	private:
+		using Element = std::tuple<std::size_t, std::size_t, ContainedT>;
+
+		std::size_t m_rows;
+		std::size_t m_cols;
+		std::vector<Element> m_elements;
+	};
+
+	namespace detail
+	{
+		// Splits rows into chunks with about the same amount of non zero elements, rows of
+		// graph matrixes differ in length a lot, so equal amounts of rows don't balance threads
+		template<typename T, typename Func>
+		void ForBalancedRows(const SparseMatrix<T> &matrix, std::size_t operationsPerElement, Func &&func)
+		{
+			const std::size_t rows = matrix.Rows();
+			const std::size_t nonZeros = matrix.NonZeros();
+			if (rows < 2 || !parallel::ShouldParallelize(nonZeros * operationsPerElement))
+			{
+				func(std::size_t{0}, rows);
+				return;
+			}
+
+			const std::shared_ptr<ThreadPool> pool{parallel::DefaultThreadPool()};
+			const std::size_t chunksCount{std::min(rows, pool->ThreadsCount() * 4)};
+			const std::span<const std::size_t> offsets = matrix.RowOffsets();
+			// Chunk starts at first row that begins after its share of elements, neighbouring chunks use the same bound
+			const auto chunkStart = [&](std::size_t chunk) -> std::size_t {
+				if (chunk == chunksCount)
+				{
+					return rows;
+				}
+				const std::span<const std::size_t> starts = offsets.first(rows);
+				return static_cast<std::size_t>(std::lower_bound(starts.begin(), starts.end(),
+					nonZeros * chunk / chunksCount) - starts.begin());
+			};
+			pool->ParallelFor(chunksCount, [&](std::size_t chunk) {
+				const std::size_t begin = chunkStart(chunk);
+				const std::size_t end = chunkStart(chunk + 1);
+				if (begin < end)
+				{
+					func(begin, end);
+				}
+			});
+		}
+
+		// out = matrix * in for rows [rowBegin, rowEnd), in and out are dense vectors
+		template<typename T>
+		inline void SparseRowsTimesVector(const SparseMatrix<T> &matrix, const T *in, T *out,
+			std::size_t rowBegin, std::size_t rowEnd) noexcept
+		{
+			const std::size_t *offsets = matrix.RowOffsets().data();
+			const auto *cols = matrix.ColIndexes().data();
+			const T *values = matrix.Values().data();
+			for (std::size_t row = rowBegin; row < rowEnd; ++row)
+			{
+				T sum{};
+				for (std::size_t pos = offsets[row]; pos < offsets[row + 1]; ++pos)
+				{
+					sum += values[pos] * in[cols[pos]];
+				}
+				out[row] = sum;
+			}
+		}
+
+		// Row of product is sum of rows of dense matrix with coefficients from row of sparse one,
+		// rows are continuous in both, so additions are vectorized
+		template<typename T, typename M>
+		inline void SparseRowsTimesDense(const SparseMatrix<T> &matrix, const M &dense, Matrix<T> &out,
+			std::size_t rowBegin, std::size_t rowEnd)
+		{
+			const std::size_t *offsets = matrix.RowOffsets().data();
+			const auto *cols = matrix.ColIndexes().data();
+			const T *values = matrix.Values().data();
+			const std::size_t width = dense.Cols();
+			for (std::size_t row = rowBegin; row < rowEnd; ++row)
+			{
+				T *outRow = out.data() + row * out.RowStride();
+				std::fill_n(outRow, width, T{});
+				for (std::size_t pos = offsets[row]; pos < offsets[row + 1]; ++pos)
+				{
+					const T coefficient = values[pos];
+					if constexpr (StridedStorageMatrix<M> && std::same_as<typename M::contained, T>)
+					{
+						if (ColStrideOf(dense) == 1)
+						{
+							const T *denseRow = dense.data() + cols[pos] * RowStrideOf(dense);
+							for (std::size_t col = 0; col < width; ++col)
+							{
+								outRow[col] += coefficient * denseRow[col];
+							}
+							continue;
+						}
+					}
+					for (std::size_t col = 0; col < width; ++col)
+					{
+						outRow[col] += coefficient * static_cast<T>(UncheckedAt(dense, cols[pos], col));
+					}
+				}
+			}
+		}
+	}
+
+	// Sparse matrix by dense vector (SpMV), large products are split between threads by non zero elements
+	template<typename T>
+	[[nodiscard]] Vector<T> operator*(const SparseMatrix<T> &matrix, const Vector<T> &vector)
+	{
+		if (matrix.Cols() != vector.size())
+		{
+			throw std::length_error{fmt::format("Sparse {}x{} matrix cannot be multiplied by vector of {} elements",
+				matrix.Rows(), matrix.Cols(), vector.size())};
+		}
+		Vector<T> product(matrix.Rows());
+		const T *in = vector.data();
+		T *out = product.data();
+		detail::ForBalancedRows(matrix, 2, [&](std::size_t rowBegin, std::size_t rowEnd) {
+			detail::SparseRowsTimesVector(matrix, in, out, rowBegin, rowEnd);
+		});
+		return product;
+	}
+
+	// Sparse matrix by dense matrix (SpMM), product is dense
+	template<typename T, ReadonlyMatrixT M>
+		requires std::convertible_to<typename M::contained, T>
+	[[nodiscard]] Matrix<T> operator*(const SparseMatrix<T> &matrix, const M &dense)
+	{
+		if (matrix.Cols() != dense.Rows())
+		{
+			throw std::length_error{fmt::format("Sparse {}x{} matrix cannot be multiplied by {}x{} matrix",
+				matrix.Rows(), matrix.Cols(), dense.Rows(), dense.Cols())};
+		}
+		Matrix<T> product{matrix.Rows(), dense.Cols()};
+		detail::ForBalancedRows(matrix, 2 * dense.Cols(), [&](std::size_t rowBegin, std::size_t rowEnd) {
+			detail::SparseRowsTimesDense(matrix, dense, product, rowBegin, rowEnd);
+		});
+		return product;
+	}
+
+	static_assert(ReadonlyMatrixT<SparseMatrix<float>>, "Sparse matrix doesn't follow the ReadonlyMatrixT concept");
+}
+
+#endif // MATRIX_SPARSE_MATRIX_H
@@ -1,8 +1,227 @@
 #ifndef STATIC_MATRIXES_H
 #define STATIC_MATRIXES_H
 
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "matrix.h"
+#include "simd.h"
+
 namespace MxLib
 {
+	// Static matrixes with sides from 2 to 4, shapes of transforms in geometry code. Products, transposes,
+	// determinants and inverses of them go through closed-form kernels below, that are unrolled at
+	// compile time, have no branches on elements and never allocate
+	template<typename M>
+	concept SmallStaticMatrixT = StaticMatrixT<M> &&
+		std::same_as<M, SMatrix<typename M::contained, M::ROWS, M::COLS>> &&
+		std::is_arithmetic_v<typename M::contained> &&
+		M::ROWS >= 2 && M::ROWS <= 4 && M::COLS >= 2 && M::COLS <= 4;
+
+	template<typename M>
+	concept SmallSquareMatrixT = SmallStaticMatrixT<M> && M::ROWS == M::COLS;
+
+	template<typename LM, typename RM>
+	concept SmallProductT = SmallStaticMatrixT<LM> && SmallStaticMatrixT<RM> &&
+		std::same_as<typename LM::contained, typename RM::contained> && LM::COLS == RM::ROWS;
+
+	namespace detail
+	{
+		template<std::size_t STRIDE, typename T, std::size_t... Iter>
+		[[nodiscard]] constexpr inline T UnrolledDot(const T *row, const T *col, std::index_sequence<Iter...> /*unused*/) noexcept
+		{
+			return ((row[Iter] * col[Iter * STRIDE]) + ...);
+		}
+
+		template<std::size_t INNER, std::size_t COLS, typename T, std::size_t... Cells>
+		constexpr inline void UnrolledProduct(const T *lhs, const T *rhs, T *out, std::index_sequence<Cells...> /*unused*/) noexcept
+		{
+			((out[Cells] = UnrolledDot<COLS>(lhs + Cells / COLS * INNER, rhs + Cells % COLS, std::make_index_sequence<INNER>{})), ...);
+		}
+
+#if MATHX_SIMD_VECTORS
+		// Row of product is combination of rows of right matrix with coefficients from row of left one
+		template<typename V, typename T, std::size_t... Iter>
+		[[gnu::always_inline]] inline void CombineRows(typename V::type &out, const T *coefficients,
+			const typename V::type *rows, std::index_sequence<Iter...> /*unused*/) noexcept
+		{
+			out = ((coefficients[Iter] * rows[Iter]) + ...);
+		}
+
+		// Rows of 4 floating point elements are single vectors, float ones fit into SSE or NEON register
+		template<std::size_t INNER, typename T, std::size_t... Rows>
+		[[gnu::always_inline]] inline void VectorProduct(const T *lhs, const T *rhs, T *out, std::index_sequence<Rows...> /*unused*/) noexcept
+		{
+			using V = simd::detail::Vector<T, 4 * sizeof(T)>;
+
+			typename V::type rhsRows[INNER];
+			for (std::size_t iter = 0; iter < INNER; ++iter)
+			{
+				V::Load(rhsRows[iter], rhs + iter * 4);
+			}
+			typename V::type outRows[sizeof...(Rows)];
+			(CombineRows<V>(outRows[Rows], lhs + Rows * INNER, rhsRows, std::make_index_sequence<INNER>{}), ...);
+			(V::Store(out + Rows * 4, outRows[Rows]), ...);
+		}
+#endif
+
+		template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+		[[nodiscard]] constexpr SMatrix<T, ROWS, COLS> SmallProduct(const SMatrix<T, ROWS, INNER> &lhs, const SMatrix<T, INNER, COLS> &rhs) noexcept
+		{
+			SMatrix<T, ROWS, COLS> out{};
+#if MATHX_SIMD_VECTORS
+			if constexpr (COLS == 4 && std::floating_point<T>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					VectorProduct<INNER>(lhs.data(), rhs.data(), out.data(), std::make_index_sequence<ROWS>{});
+					return out;
+				}
+			}
+#endif
+			UnrolledProduct<INNER, COLS>(lhs.data(), rhs.data(), out.data(), std::make_index_sequence<ROWS * COLS>{});
+			return out;
+		}
+
+		// Element (row, col) of output is taken from (col, row) of input
+		template<std::size_t ROWS, std::size_t COLS, typename T, std::size_t... Cells>
+		constexpr inline void UnrolledTranspose(const T *in, T *out, std::index_sequence<Cells...> /*unused*/) noexcept
+		{
+			((out[Cells] = in[Cells % ROWS * COLS + Cells / ROWS]), ...);
+		}
+
+		template<typename T, std::size_t ROWS, std::size_t COLS>
+		[[nodiscard]] constexpr SMatrix<T, COLS, ROWS> SmallTranspose(const SMatrix<T, ROWS, COLS> &matrix) noexcept
+		{
+			SMatrix<T, COLS, ROWS> out{};
+#if MATHX_SIMD_VECTORS
+			if constexpr (ROWS == 4 && COLS == 4 && std::floating_point<T>)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					simd::detail::TransposeRegisters<T, 4 * sizeof(T)>(matrix.data(), 4, out.data(), 4, std::make_index_sequence<4>{});
+					return out;
+				}
+			}
+#endif
+			UnrolledTranspose<ROWS, COLS>(matrix.data(), out.data(), std::make_index_sequence<ROWS * COLS>{});
+			return out;
+		}
+
+		// 2x2 minors of two top and two bottom rows of 4x4 matrix, determinant and
+		// adjugate are both combinations of them (Laplace expansion by two rows)
+		template<typename T>
+		struct PairMinors
+		{
+			T top[6];
+			T bottom[6];
+
+			constexpr explicit PairMinors(const T *a) noexcept :
+				top{
+					a[0] * a[5] - a[4] * a[1],
+					a[0] * a[6] - a[4] * a[2],
+					a[0] * a[7] - a[4] * a[3],
+					a[1] * a[6] - a[5] * a[2],
+					a[1] * a[7] - a[5] * a[3],
+					a[2] * a[7] - a[6] * a[3]},
+				bottom{
+					a[8] * a[13] - a[12] * a[9],
+					a[8] * a[14] - a[12] * a[10],
+					a[8] * a[15] - a[12] * a[11],
+					a[9] * a[14] - a[13] * a[10],
+					a[9] * a[15] - a[13] * a[11],
+					a[10] * a[15] - a[14] * a[11]}
+			{}
+
+			[[nodiscard]] constexpr inline T Determinant() const noexcept
+			{
+				return top[0] * bottom[5] - top[1] * bottom[4] + top[2] * bottom[3]
+					+ top[3] * bottom[2] - top[4] * bottom[1] + top[5] * bottom[0];
+			}
+		};
+
+		template<typename T, std::size_t N>
+		[[nodiscard]] constexpr T SmallDeterminant(const SMatrix<T, N, N> &matrix) noexcept
+		{
+			const T *a = matrix.data();
+			if constexpr (N == 2)
+			{
+				return a[0] * a[3] - a[1] * a[2];
+			}
+			else if constexpr (N == 3)
+			{
+				return a[0] * (a[4] * a[8] - a[5] * a[7])
+					- a[1] * (a[3] * a[8] - a[5] * a[6])
+					+ a[2] * (a[3] * a[7] - a[4] * a[6]);
+			}
+			else
+			{
+				return PairMinors<T>{a}.Determinant();
+			}
+		}
+
+		// Writes adjugate (transposed cofactors) of matrix to out and returns determinant
+		template<typename T, std::size_t N>
+		constexpr T SmallAdjugate(const SMatrix<T, N, N> &matrix, SMatrix<T, N, N> &out) noexcept
+		{
+			const T *a = matrix.data();
+			T adjugate[N * N];
+			T determinant;
+			if constexpr (N == 2)
+			{
+				adjugate[0] = a[3];
+				adjugate[1] = -a[1];
+				adjugate[2] = -a[2];
+				adjugate[3] = a[0];
+				determinant = a[0] * a[3] - a[1] * a[2];
+			}
+			else if constexpr (N == 3)
+			{
+				adjugate[0] = a[4] * a[8] - a[5] * a[7];
+				adjugate[1] = a[2] * a[7] - a[1] * a[8];
+				adjugate[2] = a[1] * a[5] - a[2] * a[4];
+				adjugate[3] = a[5] * a[6] - a[3] * a[8];
+				adjugate[4] = a[0] * a[8] - a[2] * a[6];
+				adjugate[5] = a[2] * a[3] - a[0] * a[5];
+				adjugate[6] = a[3] * a[7] - a[4] * a[6];
+				adjugate[7] = a[1] * a[6] - a[0] * a[7];
+				adjugate[8] = a[0] * a[4] - a[1] * a[3];
+				determinant = a[0] * adjugate[0] + a[1] * adjugate[3] + a[2] * adjugate[6];
+			}
+			else
+			{
+				const PairMinors<T> minors{a};
+				const T *s = minors.top;
+				const T *c = minors.bottom;
+				adjugate[0] = a[5] * c[5] - a[6] * c[4] + a[7] * c[3];
+				adjugate[1] = -a[1] * c[5] + a[2] * c[4] - a[3] * c[3];
+				adjugate[2] = a[13] * s[5] - a[14] * s[4] + a[15] * s[3];
+				adjugate[3] = -a[9] * s[5] + a[10] * s[4] - a[11] * s[3];
+				adjugate[4] = -a[4] * c[5] + a[6] * c[2] - a[7] * c[1];
+				adjugate[5] = a[0] * c[5] - a[2] * c[2] + a[3] * c[1];
+				adjugate[6] = -a[12] * s[5] + a[14] * s[2] - a[15] * s[1];
+				adjugate[7] = a[8] * s[5] - a[10] * s[2] + a[11] * s[1];
+				adjugate[8] = a[4] * c[4] - a[5] * c[2] + a[7] * c[0];
+				adjugate[9] = -a[0] * c[4] + a[1] * c[2] - a[3] * c[0];
+				adjugate[10] = a[12] * s[4] - a[13] * s[2] + a[15] * s[0];
+				adjugate[11] = -a[8] * s[4] + a[9] * s[2] - a[11] * s[0];
+				adjugate[12] = -a[4] * c[3] + a[5] * c[1] - a[6] * c[0];
+				adjugate[13] = a[0] * c[3] - a[1] * c[1] + a[2] * c[0];
+				adjugate[14] = -a[12] * s[3] + a[13] * s[1] - a[14] * s[0];
+				adjugate[15] = a[8] * s[3] - a[9] * s[1] + a[10] * s[0];
+				determinant = minors.Determinant();
+			}
+			// Matrix may be out itself, so it is overwritten only after all cofactors are computed
+			T *outData = out.data();
+			for (std::size_t pos = 0; pos < N * N; ++pos)
+			{
+				outData[pos] = adjugate[pos];
+			}
+			return determinant;
+		}
+	}
 }
 
 #endif // STATIC_MATRIXES_H
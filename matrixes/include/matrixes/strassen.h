@@ -0,0 +1,241 @@
+#ifndef MATRIX_STRASSEN_H
+#define MATRIX_STRASSEN_H
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+
+#include "gemm.h"
+#include "scratch_arena.h"
+#include "thread_pool.h"
+
+namespace MxLib
+{
+	// Strassen-Winograd product takes 7 half sized products instead of 8 on every level, so
+	// large products take less operations, but rounding errors grow with depth of recursion.
+	// It is disabled by default and applies only to floating point products
+	namespace strassen
+	{
+		// Products with every dimension at least this are split, smaller ones use classic kernel
+		static inline constexpr const std::size_t DEFAULT_CUTOFF{1024};
+
+		namespace detail
+		{
+			[[nodiscard]] inline std::atomic<bool> &Enabled() noexcept
+			{
+				static std::atomic<bool> enabled{false};
+				return enabled;
+			}
+
+			[[nodiscard]] inline std::atomic<std::size_t> &Cutoff() noexcept
+			{
+				static std::atomic<std::size_t> cutoff{DEFAULT_CUTOFF};
+				return cutoff;
+			}
+		}
+
+		inline void SetEnabled(bool enabled) noexcept
+		{
+			detail::Enabled().store(enabled, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] inline bool Enabled() noexcept
+		{
+			return detail::Enabled().load(std::memory_order_relaxed);
+		}
+
+		// Dimension below which recursion stops, at least 2
+		inline void SetCutoff(std::size_t dimension) noexcept
+		{
+			detail::Cutoff().store(std::max<std::size_t>(dimension, 2), std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] inline std::size_t Cutoff() noexcept
+		{
+			return detail::Cutoff().load(std::memory_order_relaxed);
+		}
+
+		// Products of floating point matrixes with the same element types
+		template<typename TC, typename TA, typename TB>
+		concept ApplicableT = std::floating_point<TC> && std::same_as<TA, TC> && std::same_as<TB, TC>;
+
+		// Whether m x k by k x n product is computed by Strassen-Winograd recursion
+		[[nodiscard]] inline bool ShouldUse(std::size_t m, std::size_t n, std::size_t k) noexcept
+		{
+			return Enabled() && std::min({m, n, k}) >= Cutoff();
+		}
+	}
+
+	namespace detail
+	{
+		template<typename T>
+		[[nodiscard]] constexpr inline GemmOperand<T> OperandBlock(const GemmOperand<T> &operand, std::size_t row, std::size_t col) noexcept
+		{
+			return {operand.data + row * operand.rowStride + col * operand.colStride, operand.rowStride, operand.colStride};
+		}
+
+		// Elements taken by temporaries of every level below m x k by k x n product, all levels
+		// below are run one after another, so they share the same part of workspace
+		template<typename T>
+		[[nodiscard]] std::size_t StrassenWorkspace(std::size_t m, std::size_t n, std::size_t k, std::size_t cutoff) noexcept
+		{
+			// Temporaries start at cache line, as the rest of packed buffers do
+			constexpr std::size_t LINE = CACHE_LINE_SIZE / sizeof(T);
+			std::size_t elements = 0;
+			for (; std::min({m, n, k}) >= cutoff; m /= 2, n /= 2, k /= 2)
+			{
+				const std::size_t left = (m / 2 * std::max(k / 2, n / 2) + LINE - 1) / LINE * LINE;
+				const std::size_t right = (k / 2 * n / 2 + LINE - 1) / LINE * LINE;
+				elements += left + right;
+			}
+			return elements;
+		}
+
+		// out = lhs + sign * rhs for rows x cols blocks, out may be the same block as lhs or rhs
+		template<typename T>
+		void StrassenCombine(std::size_t rows, std::size_t cols, const GemmOperand<T> &lhs, T sign,
+			const GemmOperand<T> &rhs, T *out, std::size_t outStride)
+		{
+			parallel::ForRows(rows, cols, [&](std::size_t rowStart, std::size_t rowEnd) {
+				for (std::size_t row = rowStart; row < rowEnd; ++row)
+				{
+					T *outRow = out + row * outStride;
+					if (lhs.colStride == 1 && rhs.colStride == 1)
+					{
+						const T *lhsRow = lhs.data + row * lhs.rowStride;
+						const T *rhsRow = rhs.data + row * rhs.rowStride;
+						for (std::size_t col = 0; col < cols; ++col)
+						{
+							outRow[col] = lhsRow[col] + sign * rhsRow[col];
+						}
+						continue;
+					}
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						outRow[col] = lhs(row, col) + sign * rhs(row, col);
+					}
+				}
+			});
+		}
+
+		// C = alpha * A * B with Winograd's form of Strassen recursion, which takes 15 block additions
+		// per level and two temporaries: X of m/2 x max(k/2, n/2) and Y of k/2 x n/2. Odd last row and
+		// col of operands are peeled off and added by classic kernel after even part is computed
+		template<typename T>
+		void StrassenRecursive(std::size_t m, std::size_t n, std::size_t k, T alpha,
+			const GemmOperand<T> &a, const GemmOperand<T> &b, T *c, std::size_t cRowStride,
+			std::size_t cutoff, T *workspace)
+		{
+			if (std::min({m, n, k}) < cutoff)
+			{
+				Gemm(m, n, k, alpha, a, b, T{}, c, cRowStride);
+				return;
+			}
+
+			constexpr std::size_t LINE = CACHE_LINE_SIZE / sizeof(T);
+			const std::size_t hm = m / 2;
+			const std::size_t hn = n / 2;
+			const std::size_t hk = k / 2;
+			T *x = workspace;
+			T *y = x + (hm * std::max(hk, hn) + LINE - 1) / LINE * LINE;
+			T *below = y + (hk * hn + LINE - 1) / LINE * LINE;
+			// Temporaries are stored without padding, X has stride of the block it holds
+			const GemmOperand<T> xAsA{x, hk, 1};
+			const GemmOperand<T> xAsC{x, hn, 1};
+			const GemmOperand<T> yAsB{y, hn, 1};
+
+			const GemmOperand<T> a11{a};
+			const GemmOperand<T> a12{OperandBlock(a, 0, hk)};
+			const GemmOperand<T> a21{OperandBlock(a, hm, 0)};
+			const GemmOperand<T> a22{OperandBlock(a, hm, hk)};
+			const GemmOperand<T> b11{b};
+			const GemmOperand<T> b12{OperandBlock(b, 0, hn)};
+			const GemmOperand<T> b21{OperandBlock(b, hk, 0)};
+			const GemmOperand<T> b22{OperandBlock(b, hk, hn)};
+			T *c11 = c;
+			T *c12 = c + hn;
+			T *c21 = c + hm * cRowStride;
+			T *c22 = c21 + hn;
+			const GemmOperand<T> c11In{c11, cRowStride, 1};
+			const GemmOperand<T> c12In{c12, cRowStride, 1};
+			const GemmOperand<T> c21In{c21, cRowStride, 1};
+			const GemmOperand<T> c22In{c22, cRowStride, 1};
+
+			const auto product = [&](const GemmOperand<T> &lhs, const GemmOperand<T> &rhs, T *out, std::size_t outStride) {
+				StrassenRecursive(hm, hn, hk, alpha, lhs, rhs, out, outStride, cutoff, below);
+			};
+
+			// S3 = A11 - A21, T3 = B22 - B12, P7 = S3 * T3 in C21
+			StrassenCombine(hm, hk, a11, T{-1}, a21, x, hk);
+			StrassenCombine(hk, hn, b22, T{-1}, b12, y, hn);
+			product(xAsA, yAsB, c21, cRowStride);
+			// S1 = A21 + A22, T1 = B12 - B11, P5 = S1 * T1 in C22
+			StrassenCombine(hm, hk, a21, T{1}, a22, x, hk);
+			StrassenCombine(hk, hn, b12, T{-1}, b11, y, hn);
+			product(xAsA, yAsB, c22, cRowStride);
+			// S2 = S1 - A11, T2 = B22 - T1, P6 = S2 * T2 in C12
+			StrassenCombine(hm, hk, xAsA, T{-1}, a11, x, hk);
+			StrassenCombine(hk, hn, b22, T{-1}, yAsB, y, hn);
+			product(xAsA, yAsB, c12, cRowStride);
+			// S4 = A12 - S2, P3 = S4 * B22 in C11
+			StrassenCombine(hm, hk, a12, T{-1}, xAsA, x, hk);
+			product(xAsA, b22, c11, cRowStride);
+			// P1 = A11 * B11 in X
+			product(a11, b11, x, hn);
+			// U2 = P1 + P6 in C12, U3 = U2 + P7 in C21, U4 = U2 + P5 in C12,
+			// U7 = U3 + P5 in C22, U5 = U4 + P3 in C12
+			StrassenCombine(hm, hn, xAsC, T{1}, c12In, c12, cRowStride);
+			StrassenCombine(hm, hn, c12In, T{1}, c21In, c21, cRowStride);
+			StrassenCombine(hm, hn, c12In, T{1}, c22In, c12, cRowStride);
+			StrassenCombine(hm, hn, c21In, T{1}, c22In, c22, cRowStride);
+			StrassenCombine(hm, hn, c12In, T{1}, c11In, c12, cRowStride);
+			// T4 = T2 - B21, P4 = A22 * T4 in C11, U6 = U3 - P4 in C21
+			StrassenCombine(hk, hn, yAsB, T{-1}, b21, y, hn);
+			product(a22, yAsB, c11, cRowStride);
+			StrassenCombine(hm, hn, c21In, T{-1}, c11In, c21, cRowStride);
+			// P2 = A12 * B21 in C11, U1 = P1 + P2 in C11
+			product(a12, b21, c11, cRowStride);
+			StrassenCombine(hm, hn, xAsC, T{1}, c11In, c11, cRowStride);
+
+			// Dynamic peeling of odd dimensions
+			if (k % 2 != 0)
+			{
+				Gemm(2 * hm, 2 * hn, std::size_t{1}, alpha, OperandBlock(a, 0, k - 1), OperandBlock(b, k - 1, 0), T{1}, c, cRowStride);
+			}
+			if (n % 2 != 0)
+			{
+				Gemm(2 * hm, std::size_t{1}, k, alpha, a, OperandBlock(b, 0, n - 1), T{}, c + n - 1, cRowStride);
+			}
+			if (m % 2 != 0)
+			{
+				Gemm(std::size_t{1}, n, k, alpha, OperandBlock(a, m - 1, 0), b, T{}, c + (m - 1) * cRowStride, cRowStride);
+			}
+		}
+
+		// Computes C = alpha * A * B + beta * C as Gemm does, workspace of all levels is taken
+		// from arena of calling thread at once
+		template<typename T>
+		void GemmStrassen(std::size_t m, std::size_t n, std::size_t k, T alpha,
+			const GemmOperand<T> &a, const GemmOperand<T> &b,
+			T beta, T *c, std::size_t cRowStride)
+		{
+			const std::size_t cutoff = strassen::Cutoff();
+			ScratchArena &arena{ThreadScratchArena()};
+			const ScratchArena::Scope scope{arena};
+			T *workspace = arena.Allocate<T>(StrassenWorkspace<T>(m, n, k, cutoff));
+			if (beta == T{})
+			{
+				StrassenRecursive(m, n, k, alpha, a, b, c, cRowStride, cutoff, workspace);
+				return;
+			}
+
+			// Recursion overwrites its output, so product is added to scaled C afterwards
+			T *product = arena.Allocate<T>(m * n);
+			StrassenRecursive(m, n, k, alpha, a, b, product, n, cutoff, workspace);
+			StrassenCombine(m, n, GemmOperand<T>{product, n, 1}, beta, GemmOperand<T>{c, cRowStride, 1}, c, cRowStride);
+		}
+	}
+}
+
+#endif // MATRIX_STRASSEN_H
@@ -0,0 +1,185 @@
+#ifndef MATRIX_STREAMING_H
+#define MATRIX_STREAMING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+
+#include <fmt/format.h>
+
+#include "allocator.h"
+#include "operations.h"
+#include "serialization.h"
+#include "simd.h"
+#include "thread_pool.h"
+#include "vector.h"
+
+namespace MxLib
+{
+	// Size of row chunks read by streaming operations, two chunks are kept in memory at once
+	static inline constexpr const std::size_t DEFAULT_STREAM_CHUNK_BYTES{std::size_t{64} << 20};
+
+	// Reads binary matrix file (see serialization.h) in chunks of whole rows. Next chunk is read on
+	// separate thread while current one is processed, so disk and CPU work at the same time and
+	// memory use is bounded by two chunks whatever size of file is
+	template<SerializableT T>
+	class RowChunkStream
+	{
+	public:
+		explicit RowChunkStream(const std::filesystem::path &path, std::size_t chunkBytes = DEFAULT_STREAM_CHUNK_BYTES) :
+			m_path{path},
+			m_file{path, O_RDONLY},
+			m_header{detail::ReadHeader<T>(m_file.Get(), path)},
+			m_chunkRows{std::clamp<std::size_t>(chunkBytes / sizeof(T) / std::max<std::size_t>(Cols(), 1), 1,
+				std::max<std::size_t>(Rows(), 1))}
+		{
+			::posix_fadvise(m_file.Get(), 0, 0, POSIX_FADV_SEQUENTIAL);
+		}
+
+		[[nodiscard]] inline std::size_t Rows() const noexcept { return static_cast<std::size_t>(m_header.rows); }
+		[[nodiscard]] inline std::size_t Cols() const noexcept { return static_cast<std::size_t>(m_header.cols); }
+		[[nodiscard]] inline std::size_t ChunkRows() const noexcept { return m_chunkRows; }
+
+		// Calls func(rowStart, rowEnd, rows) for chunks in order, rows are stored continuously without padding
+		template<typename Func>
+		void ForEachChunk(Func &&func) const
+		{
+			if (Rows() == 0)
+			{
+				return;
+			}
+
+			std::vector<T, DefaultAllocator<T>> current(m_chunkRows * Cols());
+			std::vector<T, DefaultAllocator<T>> next(m_chunkRows * Cols());
+			ReadChunk(current, 0);
+			for (std::size_t rowStart = 0; rowStart < Rows(); rowStart += m_chunkRows)
+			{
+				const std::size_t rowEnd = std::min(rowStart + m_chunkRows, Rows());
+				// Future waits for reading thread when it is destroyed, also when func throws
+				std::future<void> pending;
+				if (rowEnd < Rows())
+				{
+					pending = std::async(std::launch::async, [this, &next, rowEnd] { ReadChunk(next, rowEnd); });
+				}
+				func(rowStart, rowEnd, static_cast<const T *>(current.data()));
+				if (pending.valid())
+				{
+					pending.get();
+				}
+				std::swap(current, next);
+			}
+		}
+
+	private:
+		void ReadChunk(std::vector<T, DefaultAllocator<T>> &buffer, std::size_t rowStart) const
+		{
+			const std::size_t rowEnd = std::min(rowStart + m_chunkRows, Rows());
+			detail::ReadAll(m_file.Get(), buffer.data(), (rowEnd - rowStart) * Cols() * sizeof(T),
+				m_header.dataOffset + rowStart * Cols() * sizeof(T), m_path);
+		}
+
+		std::filesystem::path m_path;
+		detail::FileDescriptor m_file;
+		MatrixFileHeader m_header;
+		std::size_t m_chunkRows;
+	};
+
+	namespace detail
+	{
+		template<typename T>
+		[[nodiscard]] inline T RowDot(const T *lhs, const T *rhs, std::size_t count) noexcept
+		{
+			if constexpr (simd::SimdSupported<T>)
+			{
+				return simd::ActiveKernels<T>().dot(lhs, rhs, count);
+			}
+			else
+			{
+				T sum{};
+				for (std::size_t index = 0; index < count; ++index)
+				{
+					sum += lhs[index] * rhs[index];
+				}
+				return sum;
+			}
+		}
+	}
+
+	// Product of matrix stored in binary matrix file and vector, A * x or, when transposed, Aᵀ * x.
+	// Matrix is never held in memory as a whole, only two chunks of chunkBytes are
+	template<SerializableT T>
+	[[nodiscard]] Vector<T> StreamingGemv(const std::filesystem::path &path, const Vector<T> &vector,
+		Transposition transposition = Transposition::None, std::size_t chunkBytes = DEFAULT_STREAM_CHUNK_BYTES)
+	{
+		const RowChunkStream<T> stream{path, chunkBytes};
+		const std::size_t rows = stream.Rows();
+		const std::size_t cols = stream.Cols();
+		const T *in = vector.data();
+
+		if (transposition == Transposition::None)
+		{
+			if (vector.size() != cols)
+			{
+				throw std::length_error{fmt::format("Vector of {} elements cannot be multiplied by {}x{} matrix",
+					vector.size(), rows, cols)};
+			}
+			Vector<T> product(rows);
+			T *out = product.data();
+			stream.ForEachChunk([&](std::size_t rowStart, std::size_t rowEnd, const T *chunk) {
+				parallel::ForRows(rowEnd - rowStart, cols, [&](std::size_t begin, std::size_t end) {
+					for (std::size_t row = begin; row < end; ++row)
+					{
+						out[rowStart + row] = detail::RowDot(chunk + row * cols, in, cols);
+					}
+				});
+			});
+			return product;
+		}
+
+		if (vector.size() != rows)
+		{
+			throw std::length_error{fmt::format("Vector of {} elements cannot be multiplied by transposed {}x{} matrix",
+				vector.size(), rows, cols)};
+		}
+		// Every row of chunk is added to product with coefficient from vector, threads own blocks of columns
+		Vector<T> product(cols);
+		T *out = product.data();
+		std::fill_n(out, cols, T{});
+		stream.ForEachChunk([&](std::size_t rowStart, std::size_t rowEnd, const T *chunk) {
+			const std::size_t chunkRows = rowEnd - rowStart;
+			parallel::ForRows(cols, chunkRows, [&](std::size_t begin, std::size_t end) {
+				// Four rows are added at once, so product is loaded and stored four times less
+				std::size_t row = 0;
+				for (; row + 4 <= chunkRows; row += 4)
+				{
+					const T *coefficients = in + rowStart + row;
+					const T *first = chunk + row * cols;
+					for (std::size_t col = begin; col < end; ++col)
+					{
+						out[col] += coefficients[0] * first[col] + coefficients[1] * first[cols + col] +
+							coefficients[2] * first[2 * cols + col] + coefficients[3] * first[3 * cols + col];
+					}
+				}
+				for (; row < chunkRows; ++row)
+				{
+					const T coefficient = in[rowStart + row];
+					const T *chunkRow = chunk + row * cols;
+					for (std::size_t col = begin; col < end; ++col)
+					{
+						out[col] += coefficient * chunkRow[col];
+					}
+				}
+			});
+		});
+		return product;
+	}
+}
+
+#endif // MATRIX_STREAMING_H
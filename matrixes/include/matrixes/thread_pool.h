@@ -0,0 +1,316 @@
+#ifndef MATRIX_THREAD_POOL_H
+#define MATRIX_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MxLib
+{
+	// Fixed size pool that runs indexed tasks, calling thread always takes part in work,
+	// so pool of N threads owns N - 1 workers
+	class ThreadPool
+	{
+	public:
+		explicit ThreadPool(std::size_t threadsCount)
+		{
+			const std::size_t workersCount = threadsCount > 1 ? threadsCount - 1 : 0;
+			m_workers.reserve(workersCount);
+			for (std::size_t worker = 0; worker < workersCount; ++worker)
+			{
+				m_workers.emplace_back([this] { WorkerLoop(); });
+			}
+		}
+
+		ThreadPool(const ThreadPool &) = delete;
+		ThreadPool &operator=(const ThreadPool &) = delete;
+		ThreadPool(ThreadPool &&) = delete;
+		ThreadPool &operator=(ThreadPool &&) = delete;
+
+		~ThreadPool() noexcept
+		{
+			{
+				std::lock_guard lock{m_mutex};
+				m_stopping = true;
+			}
+			m_jobPosted.notify_all();
+			for (std::thread &worker : m_workers)
+			{
+				worker.join();
+			}
+		}
+
+		[[nodiscard]] inline std::size_t ThreadsCount() const noexcept { return m_workers.size() + 1; }
+
+		// Calls func(task) for every task in [0, tasksCount) and waits for all of them,
+		// first exception thrown by any task is rethrown to the caller
+		template<typename Func>
+		void ParallelFor(std::size_t tasksCount, Func &&func)
+		{
+			// Nested calls from inside of a task run inline, workers are already busy
+			if (tasksCount <= 1 || m_workers.empty() || IsInsideTask())
+			{
+				for (std::size_t task = 0; task < tasksCount; ++task)
+				{
+					func(task);
+				}
+				return;
+			}
+
+			const std::lock_guard submitLock{m_submitMutex};
+
+			Job job{tasksCount, &func, [](void *callable, std::size_t task) {
+				(*static_cast<std::remove_reference_t<Func> *>(callable))(task);
+			}};
+			{
+				std::lock_guard lock{m_mutex};
+				m_job = &job;
+				++m_jobGeneration;
+			}
+			m_jobPosted.notify_all();
+
+			RunTasks(job);
+
+			std::unique_lock lock{m_mutex};
+			m_jobFinished.wait(lock, [&job] {
+				return job.completed.load(std::memory_order_acquire) == job.tasksCount;
+			});
+			m_job = nullptr;
+			m_jobFinished.wait(lock, [&job] { return job.activeWorkers == 0; });
+
+			if (job.exception)
+			{
+				std::rethrow_exception(job.exception);
+			}
+		}
+
+	private:
+		struct Job
+		{
+			Job(std::size_t tasks, void *callableToRun, void (*invokerToRun)(void *, std::size_t)) :
+				tasksCount{tasks},
+				callable{callableToRun},
+				invoker{invokerToRun}
+			{}
+
+			const std::size_t tasksCount;
+			void *const callable;
+			void (*const invoker)(void *, std::size_t);
+
+			std::atomic<std::size_t> nextTask{0};
+			std::atomic<std::size_t> completed{0};
+			// Guarded by pool mutex
+			std::size_t activeWorkers{0};
+			std::exception_ptr exception;
+		};
+
+		[[nodiscard]] static inline bool &IsInsideTask() noexcept
+		{
+			static thread_local bool insideTask{false};
+			return insideTask;
+		}
+
+		// Marks calling thread as running tasks, previous state is restored once tasks end,
+		// so thread that was already inside of task of another pool stays inside of it
+		class InsideTaskScope
+		{
+		public:
+			InsideTaskScope() noexcept :
+				m_wasInside{std::exchange(IsInsideTask(), true)}
+			{}
+
+			InsideTaskScope(const InsideTaskScope &) = delete;
+			InsideTaskScope &operator=(const InsideTaskScope &) = delete;
+
+			~InsideTaskScope() noexcept
+			{
+				IsInsideTask() = m_wasInside;
+			}
+
+		private:
+			const bool m_wasInside;
+		};
+
+		void RunTasks(Job &job)
+		{
+			const InsideTaskScope insideTask;
+			for (std::size_t task = job.nextTask.fetch_add(1, std::memory_order_relaxed);
+				task < job.tasksCount;
+				task = job.nextTask.fetch_add(1, std::memory_order_relaxed))
+			{
+				try
+				{
+					job.invoker(job.callable, task);
+				}
+				catch (...)
+				{
+					std::lock_guard lock{m_mutex};
+					if (!job.exception)
+					{
+						job.exception = std::current_exception();
+					}
+				}
+
+				if (job.completed.fetch_add(1, std::memory_order_acq_rel) + 1 == job.tasksCount)
+				{
+					std::lock_guard lock{m_mutex};
+					m_jobFinished.notify_all();
+				}
+			}
+		}
+
+		void WorkerLoop()
+		{
+			// Jobs are usually placed on the same stack address, so they are told apart by generation
+			std::size_t lastGeneration{0};
+			while (true)
+			{
+				Job *job{nullptr};
+				{
+					std::unique_lock lock{m_mutex};
+					m_jobPosted.wait(lock, [this, lastGeneration] {
+						return m_stopping || (m_job != nullptr && m_jobGeneration != lastGeneration);
+					});
+					if (m_stopping)
+					{
+						return;
+					}
+					job = m_job;
+					lastGeneration = m_jobGeneration;
+					++job->activeWorkers;
+				}
+
+				RunTasks(*job);
+
+				std::lock_guard lock{m_mutex};
+				--job->activeWorkers;
+				m_jobFinished.notify_all();
+			}
+		}
+
+		std::vector<std::thread> m_workers;
+
+		std::mutex m_submitMutex;
+		std::mutex m_mutex;
+		std::condition_variable m_jobPosted;
+		std::condition_variable m_jobFinished;
+		Job *m_job{nullptr};
+		std::size_t m_jobGeneration{0};
+		bool m_stopping{false};
+	};
+
+	namespace parallel
+	{
+		// Operations with less scalar operations than this run on calling thread only
+		static inline constexpr const std::size_t DEFAULT_PARALLEL_THRESHOLD{1 << 18};
+
+		namespace detail
+		{
+			struct PoolHolder
+			{
+				std::mutex mutex;
+				std::size_t threadsCount{std::max<std::size_t>(std::thread::hardware_concurrency(), 1)};
+				std::shared_ptr<ThreadPool> pool;
+			};
+
+			[[nodiscard]] inline PoolHolder &DefaultPoolHolder()
+			{
+				static PoolHolder holder;
+				return holder;
+			}
+
+			[[nodiscard]] inline std::atomic<std::size_t> &Threshold() noexcept
+			{
+				static std::atomic<std::size_t> threshold{DEFAULT_PARALLEL_THRESHOLD};
+				return threshold;
+			}
+		}
+
+		// Sets amount of threads used by library operations, 1 disables multithreading.
+		// Operations that are already running keep using previous pool
+		inline void SetThreadsCount(std::size_t threadsCount)
+		{
+			detail::PoolHolder &holder{detail::DefaultPoolHolder()};
+			std::lock_guard lock{holder.mutex};
+			holder.threadsCount = std::max<std::size_t>(threadsCount, 1);
+			holder.pool.reset();
+		}
+
+		[[nodiscard]] inline std::size_t ThreadsCount()
+		{
+			detail::PoolHolder &holder{detail::DefaultPoolHolder()};
+			std::lock_guard lock{holder.mutex};
+			return holder.threadsCount;
+		}
+
+		inline void SetParallelThreshold(std::size_t operationsCount) noexcept
+		{
+			detail::Threshold().store(operationsCount, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] inline std::size_t ParallelThreshold() noexcept
+		{
+			return detail::Threshold().load(std::memory_order_relaxed);
+		}
+
+		// Library owned pool, created lazily with configured amount of threads
+		[[nodiscard]] inline std::shared_ptr<ThreadPool> DefaultThreadPool()
+		{
+			detail::PoolHolder &holder{detail::DefaultPoolHolder()};
+			std::lock_guard lock{holder.mutex};
+			if (!holder.pool)
+			{
+				holder.pool = std::make_shared<ThreadPool>(holder.threadsCount);
+			}
+			return holder.pool;
+		}
+
+		// Whether operation of given amount of scalar operations should be split between threads
+		[[nodiscard]] inline bool ShouldParallelize(std::size_t operationsCount)
+		{
+			return operationsCount >= ParallelThreshold() && ThreadsCount() > 1;
+		}
+
+		// Splits [0, rows) into continuous chunks and calls func(rowStart, rowEnd) for each of them
+		// on threads of default pool, whatever amount of work is
+		template<typename Func>
+		void SplitRows(std::size_t rows, Func &&func)
+		{
+			if (rows < 2 || ThreadsCount() < 2)
+			{
+				func(std::size_t{0}, rows);
+				return;
+			}
+
+			const std::shared_ptr<ThreadPool> pool{DefaultThreadPool()};
+			// Few chunks per thread balance the load when some threads are slower
+			const std::size_t chunksCount{std::min(rows, pool->ThreadsCount() * 4)};
+			const std::size_t chunkRows{(rows + chunksCount - 1) / chunksCount};
+			pool->ParallelFor((rows + chunkRows - 1) / chunkRows, [&](std::size_t chunk) {
+				func(chunk * chunkRows, std::min(rows, (chunk + 1) * chunkRows));
+			});
+		}
+
+		// As SplitRows, but operationsPerRow is used to decide if splitting is worth it
+		template<typename Func>
+		void ForRows(std::size_t rows, std::size_t operationsPerRow, Func &&func)
+		{
+			if (rows < 2 || !ShouldParallelize(rows * operationsPerRow))
+			{
+				func(std::size_t{0}, rows);
+				return;
+			}
+			SplitRows(rows, func);
+		}
+	}
+}
+
+#endif // MATRIX_THREAD_POOL_H
@@ -1,8 +1,16 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fmt/format.h>
+
 #include "matrixes/matrix.h"
 #include "matrixes/algorithms.h"
+#include "matrixes/operations.h"
 
 namespace MxLib
 {
@@ -32,7 +40,7 @@ namespace MxLib
 		{
 			return (*this)(0, col);
 		}
-		[[nodiscard]] constexpr inline ContainedT &operator[](std::size_t col) const
+		[[nodiscard]] constexpr inline const ContainedT &operator[](std::size_t col) const
 		{
 			return (*this)(0, col);
 		}
@@ -42,6 +50,9 @@ namespace MxLib
 			return Matrix<ContainedT>::size();
 		}
 
+		// Elements are stored continuously
+		using Matrix<ContainedT>::data;
+
 		[[nodiscard]] const Matrix<ContainedT> &toMatrix() const
 		{
 			return *static_cast<Matrix<ContainedT> *>(*this);
@@ -52,6 +63,108 @@ namespace MxLib
 	using VectorD = Vector<double>;
 	using VectorI = Vector<int>;
 
+	namespace detail
+	{
+		// Elements of vector operand of matrix-vector product, element i is data[i * stride]
+		template<typename T>
+		struct VectorOperand
+		{
+			const T *data;
+			std::size_t size;
+			std::size_t stride;
+		};
+
+		template<typename T>
+		[[nodiscard]] inline VectorOperand<T> MakeVectorOperand(const Vector<T> &vector) noexcept
+		{
+			return {vector.data(), vector.size(), 1};
+		}
+
+		// Single row or col of strided storage, e.g. RowView or ColView
+		template<StridedStorageMatrix M>
+		[[nodiscard]] inline VectorOperand<typename M::contained> MakeVectorOperand(const M &matrix)
+		{
+			if (matrix.Rows() != 1 && matrix.Cols() != 1)
+			{
+				throw std::length_error{fmt::format("{}x{} matrix is not a vector", matrix.Rows(), matrix.Cols())};
+			}
+			return matrix.Rows() == 1 ? VectorOperand<typename M::contained>{matrix.data(), matrix.Cols(), ColStrideOf(matrix)} :
+				VectorOperand<typename M::contained>{matrix.data(), matrix.Rows(), RowStrideOf(matrix)};
+		}
+	}
+
+	// BLAS-like matrix-vector product y = alpha * op(A) * x + beta * y into existing vector, where x is
+	// Vector, RowView or ColView. y is not read when beta is zero
+	template<ReadonlyMatrixT M, typename XV, typename T = typename M::contained>
+		requires requires(const XV &x) { { detail::MakeVectorOperand(x) } -> std::same_as<detail::VectorOperand<T>>; }
+	Vector<T> &Gemv(std::type_identity_t<T> alpha, const M &aMatrix, const XV &x, std::type_identity_t<T> beta,
+		Vector<T> &y, Transposition transposeA = Transposition::None)
+	{
+		const std::size_t rows = detail::OperandRows(aMatrix, transposeA);
+		const std::size_t cols = detail::OperandCols(aMatrix, transposeA);
+		const detail::VectorOperand<T> in{detail::MakeVectorOperand(x)};
+		if (in.size != cols || y.size() != rows)
+		{
+			throw std::length_error{fmt::format("Product of {}x{} matrix and vector of {} elements cannot be written to vector of {}",
+				rows, cols, in.size, y.size())};
+		}
+
+		if constexpr (detail::TransposeViewT<M>)
+		{
+			return Gemv(alpha, aMatrix.Viewed(), x, beta, y, detail::Flipped(transposeA));
+		}
+		else if constexpr (MatrixExpressionT<M>)
+		{
+			return Gemv(alpha, EvaluatedMatrix<M>{aMatrix}, x, beta, y, transposeA);
+		}
+		else
+		{
+			// Output is written while x is still read, so x that is the output itself is copied
+			if (in.data == y.data() && rows != 0)
+			{
+				const Vector<T> copied(cols, in.data);
+				return Gemv(alpha, aMatrix, copied, beta, y, transposeA);
+			}
+			if constexpr (detail::GemmStorage<M>)
+			{
+				detail::Gemv(rows, cols, alpha, detail::MakeGemmOperand(aMatrix, transposeA), in.data, in.stride, beta, y.data(), std::size_t{1});
+			}
+			else
+			{
+				for (std::size_t row = 0; row < rows; ++row)
+				{
+					T sum{};
+					for (std::size_t col = 0; col < cols; ++col)
+					{
+						sum += detail::OperandAt(aMatrix, row, col, transposeA) * in.data[col * in.stride];
+					}
+					y[row] = beta == T{} ? alpha * sum : alpha * sum + beta * y[row];
+				}
+			}
+			return y;
+		}
+	}
+
+	// Matrix by column vector
+	template<ReadonlyMatrixT M, typename T>
+		requires std::same_as<typename M::contained, T>
+	[[nodiscard]] Vector<T> operator*(const M &matrix, const Vector<T> &vector)
+	{
+		Vector<T> product(matrix.Rows());
+		Gemv(T{1}, matrix, vector, T{}, product);
+		return product;
+	}
+
+	// Row vector by matrix, computed as transposed matrix by column vector
+	template<ReadonlyMatrixT M, typename T>
+		requires std::same_as<typename M::contained, T>
+	[[nodiscard]] Vector<T> operator*(const Vector<T> &vector, const M &matrix)
+	{
+		Vector<T> product(matrix.Cols());
+		Gemv(T{1}, matrix, vector, T{}, product, Transposition::Transposed);
+		return product;
+	}
+
 	template<typename ContainedT, std::size_t _size>
 	class SVector : private SMatrix<ContainedT, 1, _size>
 	{
@@ -43,6 +43,27 @@ namespace MxLib
 			CheckBounds(*this, row, col);
 			return m_viewedMatrix(m_rowStart + row, m_colStart + col);
 		}
+		[[nodiscard]] constexpr inline const contained &Unchecked(size_t row, size_t col) const
+		{
+			return UncheckedAt(m_viewedMatrix, m_rowStart + row, m_colStart + col);
+		}
+
+		// Block of strided storage is strided storage itself
+		[[nodiscard]] constexpr inline const contained *data() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.data() + m_rowStart * m_viewedMatrix.RowStride() + m_colStart * m_viewedMatrix.ColStride();
+		}
+		[[nodiscard]] constexpr inline std::size_t RowStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.RowStride();
+		}
+		[[nodiscard]] constexpr inline std::size_t ColStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.ColStride();
+		}
 
 	private:
 		std::size_t m_rowStart{0};
@@ -87,7 +108,26 @@ namespace MxLib
 			CheckBounds(*this, row, col);
 			return m_viewedMatrix(m_viewedRow, col);
 		}
+		[[nodiscard]] inline const contained &Unchecked(std::size_t /*unused*/, std::size_t col) const
+		{
+			return UncheckedAt(m_viewedMatrix, m_viewedRow, col);
+		}
 
+		[[nodiscard]] inline const contained *data() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.data() + m_viewedRow * m_viewedMatrix.RowStride();
+		}
+		[[nodiscard]] inline std::size_t RowStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.RowStride();
+		}
+		[[nodiscard]] inline std::size_t ColStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.ColStride();
+		}
 
 	private:
 		const M &m_viewedMatrix;
@@ -105,10 +145,10 @@ namespace MxLib
 			m_viewedMatrix{viewedMatrix},
 			m_viewedCol{viewedCol}
 		{
-			if (viewedCol >= viewedMatrix.Rows())
+			if (viewedCol >= viewedMatrix.Cols())
 			{
 				throw std::out_of_range{fmt::format(
-					"Cannot take view of row {} of matrix that has {} rows", viewedCol, viewedMatrix.Rows())};
+					"Cannot take view of col {} of matrix that has {} cols", viewedCol, viewedMatrix.Cols())};
 			}
 		}
 
@@ -127,13 +167,81 @@ namespace MxLib
 			CheckBounds(*this, row, col);
 			return m_viewedMatrix(row, m_viewedCol);
 		}
+		[[nodiscard]] inline const contained &Unchecked(std::size_t row, std::size_t /*unused*/) const
+		{
+			return UncheckedAt(m_viewedMatrix, row, m_viewedCol);
+		}
 
+		[[nodiscard]] inline const contained *data() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.data() + m_viewedCol * m_viewedMatrix.ColStride();
+		}
+		[[nodiscard]] inline std::size_t RowStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.RowStride();
+		}
+		[[nodiscard]] inline std::size_t ColStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.ColStride();
+		}
 
 	private:
 		const M &m_viewedMatrix;
 		std::size_t m_viewedCol;
 	};
 
+	// Transpose of matrix that is never materialized, element (row, col) is (col, row) of viewed matrix.
+	// Strided storage is described by swapped strides, so products read it through pointers
+	template<ReadonlyMatrixT M>
+	class TransposeView
+	{
+	public:
+		using contained = M::contained;
+		using viewed = M;
+
+		explicit TransposeView(const M &viewedMatrix) :
+			m_viewedMatrix{viewedMatrix}
+		{}
+
+		[[nodiscard]] constexpr inline size_t Cols() const noexcept { return m_viewedMatrix.Rows(); }
+		[[nodiscard]] constexpr inline size_t Rows() const noexcept { return m_viewedMatrix.Cols(); }
+
+		constexpr inline const contained &operator()(size_t row, size_t col) const
+		{
+			CheckBounds(*this, row, col);
+			return m_viewedMatrix(col, row);
+		}
+		[[nodiscard]] constexpr inline const contained &Unchecked(size_t row, size_t col) const
+		{
+			return UncheckedAt(m_viewedMatrix, col, row);
+		}
+
+		[[nodiscard]] constexpr inline const contained *data() const
+			requires StridedStorageMatrix<M>
+		{
+			return m_viewedMatrix.data();
+		}
+		[[nodiscard]] constexpr inline std::size_t RowStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return ColStrideOf(m_viewedMatrix);
+		}
+		[[nodiscard]] constexpr inline std::size_t ColStride() const
+			requires StridedStorageMatrix<M>
+		{
+			return RowStrideOf(m_viewedMatrix);
+		}
+
+		// Transpose of transpose is viewed matrix itself
+		[[nodiscard]] constexpr inline const M &Viewed() const noexcept { return m_viewedMatrix; }
+
+	private:
+		const M &m_viewedMatrix;
+	};
+
 	static_assert(ReadonlyMatrixT<MatrixView<MatrixF>>);
 	static_assert(ReadonlyMatrixT<MatrixView<MatrixD>>);
 
@@ -149,6 +257,15 @@ namespace MxLib
 	static_assert(ReadonlyMatrixT<RowView<MatrixView<MatrixF>>>);
 	static_assert(ReadonlyMatrixT<RowView<MatrixView<MatrixD>>>);
 
+	static_assert(StridedStorageMatrix<MatrixView<MatrixD>>);
+	static_assert(StridedStorageMatrix<RowView<MatrixView<MatrixF>>>);
+	static_assert(StridedStorageMatrix<ColView<MatrixView<MatrixD>>>);
+
+	static_assert(ReadonlyMatrixT<TransposeView<MatrixF>>);
+	static_assert(ReadonlyMatrixT<TransposeView<MatrixView<MatrixD>>>);
+	static_assert(StridedStorageMatrix<TransposeView<MatrixD>>);
+	static_assert(StridedStorageMatrix<TransposeView<MatrixView<MatrixF>>>);
+
 }
 
 #endif // MATRIX_VIEW_H
@@ -1,10 +1,19 @@
 #ifndef UNITTEST_COMMON_H
 #define UNITTEST_COMMON_H
 
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <fmt/color.h>
 
+#include "matrixes/matrix.h"
+
 MATCHER_P(IsEqualMatrix, rMatrix, "")
 {
 	if(arg.Rows() != rMatrix.Rows())
@@ -20,14 +29,16 @@ MATCHER_P(IsEqualMatrix, rMatrix, "")
 		return false;
 	}
 
-	constexpr const double DEFAULT_ACCURACY{1e-6};
+	// Elements are compared in their common type, so float matrixes are not promoted to double
+	using ValueT = std::common_type_t<std::remove_cvref_t<decltype(arg(0, 0))>, std::remove_cvref_t<decltype(rMatrix(0, 0))>>;
+	const ValueT DEFAULT_ACCURACY{static_cast<ValueT>(1e-6)};
 	for(std::size_t row = 0;
 		row < rMatrix.Rows(); row++)
 	{
 		for(std::size_t col = 0;
 			col < rMatrix.Cols(); col++)
 		{
-			const auto difference{std::abs(arg(row, col) - rMatrix(row, col))};
+			const auto difference{std::abs(static_cast<ValueT>(arg(row, col)) - static_cast<ValueT>(rMatrix(row, col)))};
 			if(difference > DEFAULT_ACCURACY)
 			{
 				*result_listener << fmt::format(fg(fmt::color::red), "\nERROR:") <<
@@ -48,7 +59,7 @@ MATCHER_P2(IsMatrixValuesInRange, rangeStart, rangeEnd, "")
 {
 	for(std::size_t row = 0; row < arg.Rows(); row++)
 	{
-		for(std::size_t col = 0; col < arg.Rows(); col++)
+		for(std::size_t col = 0; col < arg.Cols(); col++)
 		{
 			if(arg(row, col) < rangeStart ||
 				arg(row, col) > rangeEnd)
@@ -65,5 +76,43 @@ MATCHER_P2(IsMatrixValuesInRange, rangeStart, rangeEnd, "")
 	return true;
 }
 
+// File in temporary directory, that is removed once test ends
+class TemporaryFile
+{
+public:
+	explicit TemporaryFile(const std::string &name) :
+		m_path{std::filesystem::temp_directory_path() / fmt::format("mathx_{}_{}", ::getpid(), name)}
+	{}
+
+	TemporaryFile(const TemporaryFile &) = delete;
+	TemporaryFile &operator=(const TemporaryFile &) = delete;
+
+	~TemporaryFile()
+	{
+		std::error_code error;
+		std::filesystem::remove(m_path, error);
+	}
+
+	[[nodiscard]] const std::filesystem::path &Path() const noexcept { return m_path; }
+
+private:
+	std::filesystem::path m_path;
+};
+
+// Matrix of small integer values that repeat with period 11 along rows and cols, so products
+// and sums of such matrixes are exact in floating point types
+template<typename T = double>
+MxLib::Matrix<T> IndexedMatrix(std::size_t rows, std::size_t cols, MxLib::RowPadding padding = MxLib::RowPadding::None)
+{
+	MxLib::Matrix<T> matrix{rows, cols, padding};
+	for (std::size_t row = 0; row < rows; ++row)
+	{
+		for (std::size_t col = 0; col < cols; ++col)
+		{
+			matrix(row, col) = static_cast<T>((row * 7 + col * 3) % 11) - T{5};
+		}
+	}
+	return matrix;
+}
 
 #endif // UNITTEST_COMMON_H
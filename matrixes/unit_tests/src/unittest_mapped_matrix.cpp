@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/operations.h"
+#include "matrixes/algorithms.h"
+#include "matrixes/view.h"
+#include "matrixes/mapped_matrix.h"
+
+using namespace MxLib;
+
+// Dominant diagonal keeps determinants of square ones far from zero
+static MatrixD FilledMatrix(std::size_t rows, std::size_t cols)
+{
+	MatrixD matrix = IndexedMatrix(rows, cols);
+	for (std::size_t index = 0; index < std::min(rows, cols); ++index)
+	{
+		matrix(index, index) = 10.0;
+	}
+	return matrix;
+}
+
+TEST(MappedMatrixTest, CreateAndReopenTestSuccessful)
+{
+	const TemporaryFile file{"reopen.bin"};
+	const MatrixD expected = FilledMatrix(37, 29);
+	{
+		MappedMatrix<double> created = MappedMatrix<double>::Create(file.Path(), 37, 29);
+		EXPECT_EQ(created.Mode(), MapMode::ReadWrite);
+		EXPECT_THAT(created, IsEqualMatrix(FilledMatrix(37, 29) * 0.0));
+
+		created = expected;
+		created.Flush();
+		// Mapping cannot be resized
+		EXPECT_THROW(created = FilledMatrix(29, 37), std::length_error);
+	}
+	EXPECT_EQ(std::filesystem::file_size(file.Path()), 37 * 29 * sizeof(double));
+
+	MappedMatrix<double> reopened{file.Path(), 37, 29};
+	EXPECT_EQ(reopened.Mode(), MapMode::ReadOnly);
+	EXPECT_EQ(reopened.size(), 37 * 29);
+	EXPECT_THAT(reopened, IsEqualMatrix(expected));
+
+	// Moved mapping stays valid
+	const MappedMatrix<double> moved{std::move(reopened)};
+	EXPECT_THAT(moved, IsEqualMatrix(expected));
+	EXPECT_EQ(reopened.data(), nullptr);
+}
+
+TEST(MappedMatrixTest, OperationsOnMappedMatrixTestSuccessful)
+{
+	const TemporaryFile lFile{"lhs.bin"};
+	const TemporaryFile rFile{"rhs.bin"};
+	const MatrixD lExpected = FilledMatrix(48, 48);
+	const MatrixD rExpected = FilledMatrix(48, 20) * 0.5;
+	{
+		auto lCreated = MappedMatrix<double>::Create(lFile.Path(), 48, 48);
+		auto rCreated = MappedMatrix<double>::Create(rFile.Path(), 48, 20);
+		lCreated = lExpected;
+		rCreated = rExpected;
+	}
+
+	const MappedMatrix<double> lhs{lFile.Path(), 48, 48};
+	const MappedMatrix<double> rhs{rFile.Path(), 48, 20};
+	lhs.Advise(AccessPattern::Sequential);
+	rhs.AdviseRows(AccessPattern::WillNeed, 10, 20);
+
+	// Results of operations are matrixes in memory
+	const MatrixD product = lhs * rhs;
+	EXPECT_THAT(product, IsEqualMatrix(lExpected * rExpected));
+	const MatrixD sum = lhs + lhs;
+	EXPECT_THAT(sum, IsEqualMatrix(lExpected * 2.0));
+	EXPECT_THAT(algo::Transpose(rhs), IsEqualMatrix(algo::Transpose(rExpected)));
+	EXPECT_NEAR(algo::Determinant(lhs), algo::Determinant(lExpected), 1e-6 * std::abs(algo::Determinant(lExpected)));
+
+	const MatrixView block{lhs, 5, 7, 10, 12};
+	EXPECT_THAT(MatrixD{block}, IsEqualMatrix(MatrixD{MatrixView{lExpected, 5, 7, 10, 12}}));
+	EXPECT_THAT(TransposeView{lhs} * rhs, IsEqualMatrix(algo::Transpose(lExpected) * rExpected));
+
+	// Mapped matrix can be output of product
+	const TemporaryFile outFile{"out.bin"};
+	auto out = MappedMatrix<double>::Create(outFile.Path(), 48, 20);
+	MultiplyInto(lhs, rhs, out);
+	EXPECT_THAT(out, IsEqualMatrix(lExpected * rExpected));
+}
+
+TEST(MappedMatrixTest, MatrixAtOffsetTestSuccessful)
+{
+	const TemporaryFile file{"offset.bin"};
+	const std::size_t offset = 3 * sizeof(float) + 8192;
+	{
+		std::ofstream stream{file.Path(), std::ios::binary};
+		for (std::size_t index = 0; index < offset / sizeof(float) + 6; ++index)
+		{
+			const float value = static_cast<float>(index);
+			stream.write(reinterpret_cast<const char *>(&value), sizeof(value));
+		}
+	}
+
+	const MappedMatrix<float> matrix{file.Path(), 2, 3, MapMode::ReadOnly, offset};
+	const float first = static_cast<float>(offset / sizeof(float));
+	EXPECT_THAT(matrix, IsEqualMatrix(MatrixF{
+		{ first, first + 1, first + 2 },
+		{ first + 3, first + 4, first + 5 }
+	}));
+	matrix.AdviseRows(AccessPattern::Random, 1, 2);
+	EXPECT_THROW(matrix.AdviseRows(AccessPattern::Random, 1, 3), std::out_of_range);
+}
+
+TEST(MappedMatrixTest, MappingErrorsTestFailure)
+{
+	const TemporaryFile file{"errors.bin"};
+	EXPECT_THROW((MappedMatrix<double>{file.Path(), 2, 2}), std::system_error);
+
+	(void)MappedMatrix<double>::Create(file.Path(), 2, 2);
+	EXPECT_THROW((MappedMatrix<double>{file.Path(), 3, 2}), std::length_error);
+	EXPECT_THROW((MappedMatrix<double>{file.Path(), 1, 1, MapMode::ReadOnly, 3}), std::invalid_argument);
+
+	// Pages mapped for reading only are never written
+	MappedMatrix<double> readOnly{file.Path(), 2, 2};
+	EXPECT_THROW(readOnly(0, 0) = 1, std::logic_error);
+	EXPECT_THROW(Randomize(readOnly, 0.0, 1.0, 42), std::logic_error);
+	EXPECT_THROW(RandomizeNormal(readOnly, 0.0, 1.0, 42), std::logic_error);
+}
@@ -1,6 +1,12 @@
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+
 #include "unittest_common.h"
 
 #include "matrixes/algorithms.h"
+#include "matrixes/operations.h"
 #include "matrixes/view.h"
 #include "matrixes/minor.h"
 
@@ -145,6 +151,109 @@ TEST_F(MatrixConstructionTest, MoveConstructorTestSuccessful_2)
 	};
 	EXPECT_THAT(moved, IsEqualMatrix(expected));
 }
+
+namespace
+{
+	// Counts allocations made through it, state is shared so results of operations count too
+	template<typename T>
+	struct CountingAllocator
+	{
+		using value_type = T;
+
+		static inline std::size_t allocations{0};
+
+		CountingAllocator() noexcept = default;
+		template<typename U>
+		CountingAllocator(const CountingAllocator<U> & /*unused*/) noexcept {}
+
+		T *allocate(std::size_t count)
+		{
+			++allocations;
+			return std::allocator<T>{}.allocate(count);
+		}
+		void deallocate(T *pointer, std::size_t count) noexcept
+		{
+			std::allocator<T>{}.deallocate(pointer, count);
+		}
+
+		template<typename U>
+		bool operator==(const CountingAllocator<U> & /*unused*/) const noexcept { return true; }
+	};
+
+	bool IsCacheLineAligned(const void *pointer)
+	{
+		return reinterpret_cast<std::uintptr_t>(pointer) % CACHE_LINE_SIZE == 0;
+	}
+}
+
+TEST(MatrixStorageTest, AlignedStorageTestSuccessful)
+{
+	for (const std::size_t rank : std::initializer_list<std::size_t>{1, 3, 7, 64})
+	{
+		const MatrixF floatMatrix{rank};
+		const MatrixD doubleMatrix{rank, rank + 1};
+		const Matrix<char> charMatrix{rank, rank};
+
+		EXPECT_TRUE(IsCacheLineAligned(floatMatrix.data()));
+		EXPECT_TRUE(IsCacheLineAligned(doubleMatrix.data()));
+		EXPECT_TRUE(IsCacheLineAligned(charMatrix.data()));
+		EXPECT_EQ(doubleMatrix.RowStride(), rank + 1);
+	}
+}
+TEST(MatrixStorageTest, PaddedRowsTestSuccessful)
+{
+	MatrixD padded{3, 5, RowPadding::CacheLine};
+	ASSERT_EQ(padded.RowStride(), 8);
+	ASSERT_EQ(padded.size(), 15);
+
+	for (std::size_t row = 0; row < padded.Rows(); ++row)
+	{
+		EXPECT_TRUE(IsCacheLineAligned(&padded(row, 0)));
+		for (std::size_t col = 0; col < padded.Cols(); ++col)
+		{
+			padded(row, col) = static_cast<double>(row * 10 + col);
+		}
+	}
+
+	// Copies keep padding, assignments from other matrixes keep values only
+	const MatrixD copied{padded};
+	EXPECT_EQ(copied.RowStride(), 8);
+	EXPECT_THAT(copied, IsEqualMatrix(padded));
+
+	MatrixD assigned{{ 0 }};
+	assigned = padded;
+	EXPECT_THAT(assigned, IsEqualMatrix(padded));
+
+	const Matrix<float> converted{padded};
+	EXPECT_EQ(converted.RowStride(), 5);
+	EXPECT_THAT(converted, IsEqualMatrix(padded));
+}
+TEST(MatrixStorageTest, CustomAllocatorTestSuccessful)
+{
+	using CountedMatrix = Matrix<double, CountingAllocator<double>>;
+	CountingAllocator<double>::allocations = 0;
+
+	const CountedMatrix lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const CountedMatrix rMatrix{
+		{ 5, 6 },
+		{ 7, 8 }
+	};
+	EXPECT_EQ(CountingAllocator<double>::allocations, 2);
+
+	// Results of operations are allocated by allocator of left operand
+	const auto product{lMatrix * rMatrix};
+	static_assert(std::is_same_v<std::remove_const_t<decltype(product)>, CountedMatrix>);
+	EXPECT_EQ(CountingAllocator<double>::allocations, 3);
+
+	const MatrixD expected{
+		{ 19, 22 },
+		{ 43, 50 }
+	};
+	EXPECT_THAT(product, IsEqualMatrix(expected));
+}
 TEST(MatrixBoundCheckTest, MatrixInBoundGetterTestSuccessful)
 {
 	const MatrixD testMatrix{
@@ -161,8 +270,36 @@ TEST(MatrixBoundCheckTest, MatrixOutOfBoundGetterTestUnsuccessful)
 		{ 3, 4 }
 	};
 
+#if !MATHX_BOUNDS_CHECK
+	GTEST_SKIP() << "Bounds check is disabled";
+#endif
 	EXPECT_THROW({ testMatrix(0, 2); }, std::out_of_range);
 }
+TEST(MatrixBoundCheckTest, UncheckedGetterTestSuccessful)
+{
+	MatrixD testMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	testMatrix.Unchecked(2, 1) = 10;
+	EXPECT_THAT(testMatrix(2, 1), testing::DoubleEq(10));
+
+	const MatrixView view{testMatrix, 1, 1, 2, 2};
+	const MinorView minor{testMatrix, 1, 1};
+	const RowView row{testMatrix, 2};
+	const ColView col{testMatrix, 0};
+	for (std::size_t rowIndex = 0; rowIndex < 2; ++rowIndex)
+	{
+		for (std::size_t colIndex = 0; colIndex < 2; ++colIndex)
+		{
+			EXPECT_THAT(UncheckedAt(view, rowIndex, colIndex), testing::DoubleEq(view(rowIndex, colIndex)));
+			EXPECT_THAT(UncheckedAt(minor, rowIndex, colIndex), testing::DoubleEq(minor(rowIndex, colIndex)));
+		}
+	}
+	EXPECT_THAT(UncheckedAt(row, 0, 1), testing::DoubleEq(10));
+	EXPECT_THAT(UncheckedAt(col, 2, 0), testing::DoubleEq(7));
+}
 
 TEST(MatrixViewTest, BasicConstructionTestSuccessful)
 {
@@ -376,3 +513,181 @@ TEST(MatrixColViewTest, BasicViewTest)
 		ASSERT_THAT(rowView[row], viewedMatrix(row, 0));
 	}
 }
+TEST(MatrixColViewTest, WideMatrixViewTestSuccessful)
+{
+	const Matrix<int> viewedMatrix{
+		{ 1, 2, 3, 4 },
+		{ 5, 6, 7, 8 }
+	};
+
+	const ColView colView{viewedMatrix, 3};
+	EXPECT_EQ(colView[1], 8);
+	EXPECT_THROW({ ColView(viewedMatrix, 4); }, std::out_of_range);
+}
+
+TEST(MatrixStridedViewTest, ViewStridesTestSuccessful)
+{
+	MatrixD viewedMatrix{5, 7, RowPadding::CacheLine};
+	for (std::size_t row = 0; row < viewedMatrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < viewedMatrix.Cols(); ++col)
+		{
+			viewedMatrix(row, col) = static_cast<double>(row * 10 + col);
+		}
+	}
+
+	const MatrixView block{viewedMatrix, 1, 2, 3, 4};
+	EXPECT_EQ(block.data(), &viewedMatrix(1, 2));
+	EXPECT_EQ(block.RowStride(), viewedMatrix.RowStride());
+	EXPECT_EQ(block.ColStride(), 1);
+
+	const RowView row{block, 1};
+	const ColView col{block, 2};
+	EXPECT_EQ(row.data(), &viewedMatrix(2, 2));
+	EXPECT_EQ(col.data(), &viewedMatrix(1, 4));
+	EXPECT_EQ(col.RowStride(), viewedMatrix.RowStride());
+}
+TEST(MatrixStridedViewTest, TransposeViewTestSuccessful)
+{
+	MatrixD viewedMatrix{3, 5, RowPadding::CacheLine};
+	for (std::size_t row = 0; row < viewedMatrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < viewedMatrix.Cols(); ++col)
+		{
+			viewedMatrix(row, col) = static_cast<double>(row * 10 + col);
+		}
+	}
+
+	const TransposeView transposed{viewedMatrix};
+	EXPECT_EQ(transposed.Rows(), 5);
+	EXPECT_EQ(transposed.Cols(), 3);
+	EXPECT_EQ(transposed(4, 2), 24);
+	EXPECT_EQ(transposed.data(), viewedMatrix.data());
+	EXPECT_EQ(transposed.RowStride(), 1);
+	EXPECT_EQ(transposed.ColStride(), viewedMatrix.RowStride());
+
+	// Copy goes through strides and gives materialized transpose
+	const MatrixD copy{transposed};
+	const MatrixView block{viewedMatrix, 1, 1, 2, 3};
+	const TransposeView blockTransposed{block};
+	for (std::size_t row = 0; row < copy.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < copy.Cols(); ++col)
+		{
+			EXPECT_EQ(copy(row, col), viewedMatrix(col, row));
+		}
+	}
+	EXPECT_EQ(blockTransposed(2, 1), viewedMatrix(2, 3));
+	EXPECT_EQ(&blockTransposed.Viewed(), &block);
+}
+TEST(MatrixStridedViewTest, TransposeViewSelfAssignmentTestSuccessful)
+{
+	MatrixD matrix{
+		{ 0, 1, 2 },
+		{ 3, 4, 5 },
+		{ 6, 7, 8 }
+	};
+	const MatrixD original{matrix};
+	const MatrixD expected{
+		{ 0, 3, 6 },
+		{ 1, 4, 7 },
+		{ 2, 5, 8 }
+	};
+
+	matrix = TransposeView{matrix};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+
+	matrix = original;
+	matrix = TransposeView{matrix} + matrix;
+	EXPECT_THAT(matrix, IsEqualMatrix(expected + original));
+
+	// Expressions reading only the same positions are still written in place
+	matrix = original;
+	const double *storage = matrix.data();
+	matrix = matrix + matrix;
+	EXPECT_EQ(matrix.data(), storage);
+	EXPECT_THAT(matrix, IsEqualMatrix(original * 2.0));
+
+	Matrix4d staticMatrix{};
+	for (std::size_t row = 0; row < staticMatrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < staticMatrix.Cols(); ++col)
+		{
+			staticMatrix(row, col) = static_cast<double>(row * 4 + col);
+		}
+	}
+	const Matrix4d staticOriginal{staticMatrix};
+	staticMatrix = TransposeView{staticMatrix};
+	EXPECT_THAT(staticMatrix, IsEqualMatrix(algo::Transpose(staticOriginal)));
+
+	staticMatrix = staticOriginal;
+	staticMatrix = TransposeView{staticMatrix} - staticMatrix;
+	EXPECT_THAT(staticMatrix, IsEqualMatrix(algo::Transpose(staticOriginal) - staticOriginal));
+}
+TEST(MatrixStridedViewTest, ViewCopyTestSuccessful)
+{
+	MatrixF viewedMatrix{4, 19, RowPadding::CacheLine};
+	for (std::size_t row = 0; row < viewedMatrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < viewedMatrix.Cols(); ++col)
+		{
+			viewedMatrix(row, col) = static_cast<float>(row * 100 + col);
+		}
+	}
+
+	const MatrixView block{viewedMatrix, 1, 3, 3, 15};
+	const MatrixF blockCopy{block};
+	const MatrixD convertedCopy{block};
+	const MatrixF rowCopy{RowView{viewedMatrix, 2}};
+	const MatrixF colCopy{ColView{block, 4}};
+	Matrix3f staticCopy{};
+	staticCopy = MatrixView{viewedMatrix, 0, 16, 3, 3};
+
+	for (std::size_t row = 0; row < block.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < block.Cols(); ++col)
+		{
+			EXPECT_EQ(blockCopy(row, col), viewedMatrix(row + 1, col + 3));
+			EXPECT_EQ(convertedCopy(row, col), viewedMatrix(row + 1, col + 3));
+		}
+		EXPECT_EQ(colCopy(row, 0), viewedMatrix(row + 1, 7));
+	}
+	for (std::size_t col = 0; col < viewedMatrix.Cols(); ++col)
+	{
+		EXPECT_EQ(rowCopy(0, col), viewedMatrix(2, col));
+	}
+	for (std::size_t row = 0; row < 3; ++row)
+	{
+		for (std::size_t col = 0; col < 3; ++col)
+		{
+			EXPECT_EQ(staticCopy(row, col), viewedMatrix(row, col + 16));
+		}
+	}
+}
+TEST(MatrixStridedViewTest, ViewExpressionsTestSuccessful)
+{
+	MatrixD viewedMatrix{6, 21};
+	Randomize(viewedMatrix, -1, 1);
+
+	const MatrixView left{viewedMatrix, 0, 0, 3, 20};
+	const MatrixView right{viewedMatrix, 3, 1, 3, 20};
+	const MatrixD sum = left + right * 2.0;
+
+	MatrixD accumulated{left};
+	accumulated -= right;
+	for (std::size_t row = 0; row < sum.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < sum.Cols(); ++col)
+		{
+			EXPECT_DOUBLE_EQ(sum(row, col), viewedMatrix(row, col) + viewedMatrix(row + 3, col + 1) * 2.0);
+			EXPECT_DOUBLE_EQ(accumulated(row, col), viewedMatrix(row, col) - viewedMatrix(row + 3, col + 1));
+		}
+	}
+
+	const ColView column{viewedMatrix, 5};
+	const MatrixD doubled = column + column;
+	for (std::size_t row = 0; row < doubled.Rows(); ++row)
+	{
+		EXPECT_DOUBLE_EQ(doubled(row, 0), 2 * viewedMatrix(row, 5));
+	}
+}
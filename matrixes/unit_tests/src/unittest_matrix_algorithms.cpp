@@ -76,6 +76,103 @@ TEST(MatrixTransposeTest, SeveralMatrixTransposeTestSuccessful)
 	EXPECT_THAT(doubleTransposed, IsEqualMatrix(expected));
 }
 
+template<typename M>
+static M &FillByIndex(M &matrix)
+{
+	for (std::size_t row = 0; row < matrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < matrix.Cols(); ++col)
+		{
+			matrix(row, col) = static_cast<typename M::contained>(row * 1000 + col);
+		}
+	}
+	return matrix;
+}
+
+template<typename Transposed, typename M>
+static void ExpectTransposed(const Transposed &transposed, const M &matrix)
+{
+	ASSERT_EQ(transposed.Rows(), matrix.Cols());
+	ASSERT_EQ(transposed.Cols(), matrix.Rows());
+	for (std::size_t row = 0; row < matrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < matrix.Cols(); ++col)
+		{
+			ASSERT_EQ(transposed(col, row), matrix(row, col)) << "at " << row << ", " << col;
+		}
+	}
+}
+
+TEST(MatrixTransposeTest, LargeBlockedTransposeTestSuccessful)
+{
+	// Sizes are not multiples of tile, so edge tiles and uneven splits are covered
+	MatrixD doubles{131, 77};
+	MatrixF floats{45, 203};
+	Matrix<int> integers{67, 9};
+	FillByIndex(doubles);
+	FillByIndex(floats);
+	FillByIndex(integers);
+
+	ExpectTransposed(Transpose(doubles), doubles);
+	ExpectTransposed(Transpose(floats), floats);
+	ExpectTransposed(Transpose(integers), integers);
+}
+TEST(MatrixTransposeTest, PaddedAndViewTransposeTestSuccessful)
+{
+	MatrixF padded{50, 37, RowPadding::CacheLine};
+	FillByIndex(padded);
+	ExpectTransposed(Transpose(padded), padded);
+
+	const MatrixView block{padded, 3, 5, 40, 30};
+	ExpectTransposed(Transpose(block), block);
+}
+TEST(MatrixTransposeTest, SquareTransposeInplaceTestSuccessful)
+{
+	for (const std::size_t rank : std::initializer_list<std::size_t>{0, 1, 5, 8, 16, 29, 70})
+	{
+		MatrixD matrix{rank};
+		FillByIndex(matrix);
+		const MatrixD original{matrix};
+
+		const double *storage = matrix.data();
+		TransposeInplace(matrix);
+		EXPECT_EQ(matrix.data(), storage);
+		ExpectTransposed(matrix, original);
+	}
+
+	MatrixF padded{21, 21, RowPadding::CacheLine};
+	FillByIndex(padded);
+	const MatrixF original{padded};
+	TransposeInplace(padded);
+	ExpectTransposed(padded, original);
+}
+TEST(MatrixTransposeTest, StaticTransposeInplaceTestSuccessful)
+{
+	Matrix3i matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	TransposeInplace(matrix);
+	const Matrix3i expected{
+		{ 1, 4, 7 },
+		{ 2, 5, 8 },
+		{ 3, 6, 9 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+
+	SMatrix<double, 9, 9> large{};
+	FillByIndex(large);
+	const SMatrix<double, 9, 9> original{large};
+	TransposeInplace(large);
+	ExpectTransposed(large, original);
+}
+TEST(MatrixTransposeTest, NonSquareTransposeInplaceTestUnsuccessful)
+{
+	MatrixD matrix{3, 4};
+	EXPECT_THROW({ TransposeInplace(matrix); }, std::runtime_error);
+}
+
 TEST(MatrixDeterminantTest, SquareMatrixDeterminantTestSuccessful_1)
 {
 	const Matrix toGetDeterminant
@@ -111,6 +208,123 @@ TEST(MatrixDeterminantTest, LargeSquareMatrixDeterminantTestSuccessful)
 	}
 	EXPECT_THAT(Determinant(toGetDeterminant), testing::Eq(0));
 }
+TEST(MatrixDeterminantTest, LargeFloatingSquareMatrixDeterminantTestSuccessful)
+{
+	// A = L * U with unit lower L, so determinant is product of U diagonal
+	constexpr std::size_t RANK = 60;
+	MatrixD lower{RANK};
+	MatrixD upper{RANK};
+	// Seeded, as some random factors give product too ill conditioned for relative tolerance below
+	Randomize(lower, -1.0, 1.0, 4);
+	Randomize(upper, -1.0, 1.0, 5);
+
+	double expected = 1;
+	for (std::size_t row = 0; row < RANK; row++)
+	{
+		for (std::size_t col = 0; col < RANK; col++)
+		{
+			if (col > row)
+			{
+				lower(row, col) = 0;
+			}
+			if (col < row)
+			{
+				upper(row, col) = 0;
+			}
+		}
+		lower(row, row) = 1;
+		upper(row, row) = row % 2 == 0 ? 1.5 : -0.75;
+		expected *= upper(row, row);
+	}
+
+	const MatrixD toGetDeterminant{lower * upper};
+	EXPECT_THAT(Determinant(toGetDeterminant), testing::DoubleNear(expected, std::abs(expected) * 1e-8));
+}
+TEST(MatrixDeterminantTest, LargeIntegerSquareMatrixDeterminantTestSuccessful)
+{
+	// Product of unit lower and upper triangular integer matrixes with rows of lower reversed
+	constexpr std::size_t RANK = 12;
+	Matrix<long> lower{RANK};
+	Matrix<long> upper{RANK};
+	long expected = 1;
+	for (std::size_t row = 0; row < RANK; row++)
+	{
+		for (std::size_t col = 0; col < RANK; col++)
+		{
+			lower(RANK - 1 - row, col) = col < row ? static_cast<long>(row + col) % 3 - 1 : (col == row ? 1 : 0);
+			upper(row, col) = col > row ? static_cast<long>(row * col) % 5 - 2 : 0;
+		}
+		upper(row, row) = row % 4 == 0 ? -2 : 1;
+		expected *= upper(row, row);
+	}
+	// Reversing 12 rows is 6 swaps, so sign is kept
+	const Matrix<long> toGetDeterminant{lower * upper};
+	EXPECT_THAT(Determinant(toGetDeterminant), testing::Eq(expected));
+}
+TEST(MatrixDeterminantTest, WideIntermediateIntegerDeterminantTestSuccessful)
+{
+	// Elimination steps of this matrix leave 32 bit range, though determinant itself fits it
+	const Matrix<int> toGetDeterminant
+	{
+		{ -19, -41, -10, 23 },
+		{ -54, -51, 45, 8 },
+		{ -48, -14, 14, -53 },
+		{ 56, 4, -33, -56 }
+	};
+	EXPECT_THAT(Determinant(toGetDeterminant), testing::Eq(-9670415));
+
+	Matrix<int> tooLarge{3};
+	SetAll(tooLarge, 0);
+	for (std::size_t i = 0; i < 3; ++i)
+	{
+		tooLarge(i, i) = 100000;
+	}
+	EXPECT_THROW({(void)Determinant(tooLarge);}, std::overflow_error);
+}
+TEST(MatrixDeterminantTest, SingularFloatingMatrixDeterminantTestSuccessful)
+{
+	const MatrixD toGetDeterminant
+	{
+		{ 0, 0, 1 },
+		{ 0, 0, 2 },
+		{ 3, 4, 5 }
+	};
+	EXPECT_THAT(Determinant(toGetDeterminant), testing::DoubleNear(0, 1e-12));
+}
+TEST(MatrixLUTest, LUReconstructsPermutedMatrixTestSuccessful)
+{
+	const MatrixD matrix
+	{
+		{ 1, 2, 3, 4 },
+		{ 2, 1, 0, 5 },
+		{ 8, 3, 3, 1 },
+		{ 4, 4, 9, 2 }
+	};
+	const auto decomposition{LU(matrix)};
+	ASSERT_FALSE(decomposition.singular);
+
+	MatrixD lower{4};
+	MatrixD upper{4};
+	for (std::size_t row = 0; row < 4; row++)
+	{
+		for (std::size_t col = 0; col < 4; col++)
+		{
+			lower(row, col) = col < row ? decomposition.lu(row, col) : (col == row ? 1 : 0);
+			upper(row, col) = col >= row ? decomposition.lu(row, col) : 0;
+		}
+	}
+
+	MatrixD permuted{matrix};
+	for (std::size_t step = 0; step < 4; step++)
+	{
+		for (std::size_t col = 0; col < 4; col++)
+		{
+			std::swap(permuted(step, col), permuted(decomposition.pivots[step], col));
+		}
+	}
+	EXPECT_THAT(lower * upper, IsEqualMatrix(permuted));
+	EXPECT_THAT(Determinant(decomposition), testing::DoubleNear(DeterminantByExpansion(matrix), 1e-9));
+}
 TEST(MatrixDeterminantTest, SingleValueSquareMatrixDeterminantTestSuccessful)
 {
 	Matrix toGetDeterminant{ { 1 } };
@@ -181,6 +395,111 @@ TEST(MatrixInverseTest, TriangularMatrixInverseTestUnsuccessful)
 	};
 	EXPECT_THROW({(void)Inverse(toBeProcessed);}, std::runtime_error);
 }
+TEST(MatrixInverseTest, WideRangeMatrixInverseTestSuccessful)
+{
+	// Small pivot relative to largest element is not singularity while it is above rounding noise
+	const MatrixD diagonal{
+		{ 1e6, 0 },
+		{ 0, 1 }
+	};
+	const MatrixD expected{
+		{ 1e-6, 0 },
+		{ 0, 1 }
+	};
+	EXPECT_THAT(Inverse(diagonal), IsEqualMatrix(expected));
+
+	const MatrixD mixed{
+		{ 1e6, 2, 0 },
+		{ 0, 1, 0 },
+		{ 0, 3, 1 }
+	};
+	const MatrixD identity = mixed * Inverse(mixed);
+	EXPECT_THAT(identity, IsEqualMatrix(MatrixD::Identity(3)));
+}
+TEST(MatrixInverseTest, LargeMatrixInverseTestSuccessful)
+{
+	constexpr std::size_t RANK = 150;
+	MatrixD toBeProcessed{RANK};
+	Randomize(toBeProcessed, -1, 1);
+	MatrixD identity{RANK};
+	for (std::size_t row = 0; row < RANK; row++)
+	{
+		for (std::size_t col = 0; col < RANK; col++)
+		{
+			identity(row, col) = row == col ? 1 : 0;
+		}
+		// Diagonal dominance keeps random matrix well conditioned
+		toBeProcessed(row, row) += row % 2 == 0 ? RANK : -static_cast<double>(RANK);
+	}
+
+	const MatrixD inversed{Inverse(toBeProcessed)};
+	EXPECT_TRUE(IsEqualTo(toBeProcessed * inversed, identity, 1e-8));
+}
+TEST(MatrixInverseTest, InplaceMatrixInverseTestSuccessful)
+{
+	MatrixD toBeProcessed{
+		{ 0, 8, 9 },
+		{ 6, 5, 4 },
+		{ 3, 2, 2 }
+	};
+	const MatrixD expected{Inverse(toBeProcessed)};
+
+	const double *storage = toBeProcessed.data();
+	InverseInplace(toBeProcessed);
+	EXPECT_EQ(toBeProcessed.data(), storage);
+	EXPECT_THAT(toBeProcessed, IsEqualMatrix(expected));
+
+	InverseInplace(toBeProcessed);
+	const MatrixD original{
+		{ 0, 8, 9 },
+		{ 6, 5, 4 },
+		{ 3, 2, 2 }
+	};
+	EXPECT_THAT(toBeProcessed, IsEqualMatrix(original));
+}
+TEST(MatrixInverseTest, OutParameterMatrixInverseTestSuccessful)
+{
+	const Matrix toBeProcessed{
+		{ 7, 8, 9 },
+		{ 6, 5, 4 },
+		{ 3, 2, 2 }
+	};
+	MatrixD result{3};
+	Inverse(toBeProcessed, result);
+	const MatrixD expected{
+		{ -2/13.0, -2/13.0, 1 },
+		{ 0, 1, -2 },
+		{ 3/13.0, -10/13.0, 1 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+
+	MatrixD wrongSize{2};
+	EXPECT_THROW({Inverse(toBeProcessed, wrongSize);}, std::length_error);
+}
+TEST(MatrixInverseTest, PaddedMatrixInverseTestSuccessful)
+{
+	const Matrix values{
+		{ 7, 8, 9 },
+		{ 6, 5, 4 },
+		{ 3, 2, 2 }
+	};
+	MatrixD padded{3, 3, RowPadding::CacheLine};
+	Matrix<int> paddedIntegers{3, 3, RowPadding::CacheLine};
+	padded = values;
+	paddedIntegers = values;
+
+	EXPECT_NEAR(Determinant(padded), -13, 1e-9);
+	EXPECT_EQ(Determinant(paddedIntegers), -13);
+
+	const MatrixD expected{
+		{ -2/13.0, -2/13.0, 1 },
+		{ 0, 1, -2 },
+		{ 3/13.0, -10/13.0, 1 }
+	};
+	EXPECT_THAT(Inverse(padded), IsEqualMatrix(expected));
+	InverseInplace(padded);
+	EXPECT_THAT(padded, IsEqualMatrix(expected));
+}
 
 TEST(MatrixSimpleOperations, MatrixChainedOperations_1)
 {
@@ -328,3 +647,78 @@ TEST(MatrixSimpleOperations, MatrixChainedOperations_8)
 	};
 	EXPECT_THAT(result, IsEqualMatrix(expected));
 }
+TEST(MatrixMapTest, MapToDeducedTypeTestSuccessful)
+{
+	const Matrix<int> matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 }
+	};
+	const auto halves = Map(matrix, [](int value) { return value / 2.0; });
+	static_assert(std::is_same_v<std::remove_const_t<decltype(halves)>, Matrix<double>>);
+	const MatrixD expected{
+		{ 0.5, 1, 1.5 },
+		{ 2, 2.5, 3 }
+	};
+	EXPECT_THAT(halves, IsEqualMatrix(expected));
+
+	// Views and padded rows are mapped as well, source is not changed
+	MatrixD padded{5, 7, RowPadding::CacheLine};
+	SetAll(padded, 3.0);
+	const MatrixView view{padded, 1, 2, 3, 4};
+	const MatrixD squares = Map(view, [](double value) { return value * value; });
+	ASSERT_EQ(squares.Rows(), 3);
+	ASSERT_EQ(squares.Cols(), 4);
+	EXPECT_THAT(squares, IsMatrixValuesInRange(9, 9));
+	EXPECT_THAT(padded, IsMatrixValuesInRange(3, 3));
+
+	const Matrix3f identity{
+		{ 1, 0, 0 },
+		{ 0, 1, 0 },
+		{ 0, 0, 1 }
+	};
+	const auto negated = Map(identity, [](float value) { return -value; });
+	static_assert(std::is_same_v<std::remove_const_t<decltype(negated)>, Matrix3f>);
+	EXPECT_EQ(negated(1, 1), -1);
+}
+TEST(MatrixMapTest, MapInplaceTestSuccessful)
+{
+	MatrixD matrix{4, 9, RowPadding::CacheLine};
+	SetAll(matrix, 2.0);
+	EXPECT_EQ(&MapInplace(matrix, [](double value) { return value + 1; }), &matrix);
+	EXPECT_THAT(matrix, IsMatrixValuesInRange(3, 3));
+
+	// Callables without result change elements through reference
+	MapInplace(matrix, [](double &value) { value *= 2; }, Execution::Sequential);
+	EXPECT_THAT(matrix, IsMatrixValuesInRange(6, 6));
+
+	// Callables taking mutable reference and returning value get element itself
+	MapInplace(matrix, [](double &value) { return value * 2; });
+	EXPECT_THAT(matrix, IsMatrixValuesInRange(12, 12));
+	MapInplace(matrix, [](double &value) { return value -= 2; }, Execution::Parallel);
+	EXPECT_THAT(matrix, IsMatrixValuesInRange(10, 10));
+}
+TEST(MatrixMapTest, TransformTestSuccessful)
+{
+	const Matrix<int> lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const MatrixD rMatrix{
+		{ 0.5, 0.25 },
+		{ 2, 1 }
+	};
+	MatrixD out{2, 2};
+	Transform(lMatrix, rMatrix, out, [](int lhs, double rhs) { return lhs * rhs; });
+	const MatrixD expected{
+		{ 0.5, 0.5 },
+		{ 6, 4 }
+	};
+	EXPECT_THAT(out, IsEqualMatrix(expected));
+
+	Transform(out, out, [](double value) { return value - 0.5; });
+	EXPECT_THAT(out, IsEqualMatrix(expected - 0.5));
+
+	MatrixD wrongSize{2, 3};
+	EXPECT_THROW(Transform(lMatrix, wrongSize, [](int value) { return value; }), std::length_error);
+	EXPECT_THROW(Transform(lMatrix, wrongSize, out, [](int lhs, double rhs) { return lhs + rhs; }), std::length_error);
+}
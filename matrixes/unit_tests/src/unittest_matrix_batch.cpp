@@ -0,0 +1,117 @@
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/operations.h"
+#include "matrixes/algorithms.h"
+#include "matrixes/matrix_batch.h"
+
+using namespace MxLib;
+
+template<typename T, std::size_t ROWS, std::size_t COLS>
+static SMatrix<T, ROWS, COLS> MatrixOfIndex(std::size_t index)
+{
+	SMatrix<T, ROWS, COLS> matrix{};
+	for (std::size_t row = 0; row < ROWS; ++row)
+	{
+		for (std::size_t col = 0; col < COLS; ++col)
+		{
+			matrix(row, col) = static_cast<T>(static_cast<int>((index * 5 + row * 3 + col) % 13) - 6);
+		}
+	}
+	return matrix;
+}
+
+template<typename T, std::size_t ROWS, std::size_t COLS>
+static SMatrixBatch<T, ROWS, COLS> BatchOfIndexes(std::size_t count, std::size_t shift)
+{
+	SMatrixBatch<T, ROWS, COLS> batch{count};
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		batch.Set(index, MatrixOfIndex<T, ROWS, COLS>(index + shift));
+	}
+	return batch;
+}
+
+template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+static void ExpectBatchProductMatchesMatrixes(std::size_t count)
+{
+	const auto lBatch = BatchOfIndexes<T, ROWS, INNER>(count, 0);
+	const auto rBatch = BatchOfIndexes<T, INNER, COLS>(count, 7);
+
+	const SMatrixBatch<T, ROWS, COLS> product = lBatch * rBatch;
+	ASSERT_EQ(product.size(), count);
+	for (std::size_t index = 0; index < count; ++index)
+	{
+		EXPECT_THAT(product.Get(index), IsEqualMatrix(lBatch.Get(index) * rBatch.Get(index)));
+	}
+}
+
+TEST(MatrixBatchTest, LanesLayoutTestSuccessful)
+{
+	SMatrixBatch<float, 4, 4> batch{21};
+	EXPECT_EQ(batch.size(), 21);
+	EXPECT_EQ(batch.LaneStride() % (CACHE_LINE_SIZE / sizeof(float)), 0);
+	EXPECT_GE(batch.LaneStride(), 21);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.Lane(2, 3)) % CACHE_LINE_SIZE, 0);
+	EXPECT_THAT(batch.Get(20), IsEqualMatrix(Matrix4f{}));
+
+	const Matrix4f matrix{MatrixOfIndex<float, 4, 4>(3)};
+	batch.Set(5, matrix);
+	EXPECT_THAT(batch.Get(5), IsEqualMatrix(matrix));
+	EXPECT_EQ(batch.Lane(1, 2)[5], matrix(1, 2));
+	EXPECT_EQ(batch(5, 3, 0), matrix(3, 0));
+	EXPECT_EQ(batch.Lane(1, 3), batch.Lane(1, 2) + batch.LaneStride());
+
+	batch.Resize(70);
+	EXPECT_EQ(batch.size(), 70);
+	EXPECT_THAT(batch.Get(5), IsEqualMatrix(matrix));
+	EXPECT_THAT(batch.Get(69), IsEqualMatrix(Matrix4f{}));
+
+	EXPECT_THROW({(void)batch.Get(70);}, std::out_of_range);
+	EXPECT_THROW({(void)batch.Lane(4, 0);}, std::out_of_range);
+}
+TEST(MatrixBatchTest, BatchProductTestSuccessful)
+{
+	// Counts that leave partial vectors at the end
+	ExpectBatchProductMatchesMatrixes<float, 4, 4, 4>(37);
+	ExpectBatchProductMatchesMatrixes<double, 3, 3, 3>(1000);
+	ExpectBatchProductMatchesMatrixes<double, 2, 4, 3>(5);
+	ExpectBatchProductMatchesMatrixes<int, 3, 2, 3>(19);
+	ExpectBatchProductMatchesMatrixes<float, 4, 4, 4>(0);
+}
+TEST(MatrixBatchTest, AliasedBatchProductTestSuccessful)
+{
+	auto batch = BatchOfIndexes<double, 3, 3>(50, 0);
+	const auto original = batch;
+	const auto other = BatchOfIndexes<double, 3, 3>(50, 4);
+
+	MultiplyInto(batch, other, batch);
+	for (std::size_t index = 0; index < batch.size(); ++index)
+	{
+		EXPECT_THAT(batch.Get(index), IsEqualMatrix(original.Get(index) * other.Get(index)));
+	}
+}
+TEST(MatrixBatchTest, BatchAdditionAndTransposeTestSuccessful)
+{
+	const auto lBatch = BatchOfIndexes<float, 2, 3>(33, 0);
+	const auto rBatch = BatchOfIndexes<float, 2, 3>(33, 2);
+
+	const SMatrixBatch<float, 2, 3> sum = lBatch + rBatch;
+	const SMatrixBatch<float, 3, 2> transposed = algo::Transpose(lBatch);
+	for (std::size_t index = 0; index < lBatch.size(); ++index)
+	{
+		EXPECT_THAT(sum.Get(index), IsEqualMatrix(SMatrix<float, 2, 3>{lBatch.Get(index) + rBatch.Get(index)}));
+		EXPECT_THAT(transposed.Get(index), IsEqualMatrix(algo::Transpose(lBatch.Get(index))));
+	}
+}
+TEST(MatrixBatchTest, DifferentSizesBatchTestUnsuccessful)
+{
+	const SMatrixBatch<float, 4, 4> lBatch{8};
+	SMatrixBatch<float, 4, 4> rBatch{9};
+
+	EXPECT_THROW({(void)(lBatch * rBatch);}, std::length_error);
+	EXPECT_THROW({rBatch += lBatch;}, std::length_error);
+}
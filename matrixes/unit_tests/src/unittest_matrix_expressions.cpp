@@ -0,0 +1,200 @@
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/view.h"
+#include "matrixes/operations.h"
+
+using namespace MxLib;
+
+TEST(MatrixExpressionTest, ChainedExpressionIsLazyTestSuccessful)
+{
+	Matrix lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const Matrix rMatrix{
+		{ 5, 6 },
+		{ 7, 8 }
+	};
+
+	const auto expression{lMatrix + rMatrix * 2 - 1};
+	static_assert(MatrixExpressionT<std::remove_const_t<decltype(expression)>>);
+
+	// Values are taken only when expression is evaluated
+	lMatrix(0, 0) = 100;
+	const Matrix result = expression;
+	const Matrix expected{
+		{ 109, 13 },
+		{ 16, 19 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixExpressionTest, LargeFusedExpressionTestSuccessful)
+{
+	constexpr std::size_t ROWS = 300;
+	constexpr std::size_t COLS = 1001;
+
+	MatrixD aMatrix{ROWS, COLS};
+	MatrixD bMatrix{ROWS, COLS};
+	MatrixD cMatrix{ROWS, COLS};
+	Randomize(aMatrix, -5, 5);
+	Randomize(bMatrix, -5, 5);
+	Randomize(cMatrix, -5, 5);
+
+	const MatrixD result = -aMatrix + bMatrix * 2.0 - Multiply(cMatrix, aMatrix) / 4.0;
+	for (std::size_t row = 0; row < ROWS; row++)
+	{
+		for (std::size_t col = 0; col < COLS; col++)
+		{
+			const double expected = -aMatrix(row, col) + bMatrix(row, col) * 2.0 -
+				cMatrix(row, col) * aMatrix(row, col) / 4.0;
+			ASSERT_NEAR(result(row, col), expected, 1e-12);
+		}
+	}
+}
+TEST(MatrixExpressionTest, ExpressionAssignmentReusesStorageTestSuccessful)
+{
+	const MatrixD lMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 }
+	};
+	MatrixD result{
+		{ 0, 0, 0 },
+		{ 0, 0, 0 }
+	};
+	const double *storage = result.data();
+
+	result = lMatrix * 3.0 + lMatrix;
+	EXPECT_EQ(result.data(), storage);
+
+	const MatrixD expected{
+		{ 4, 8, 12 },
+		{ 16, 20, 24 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixExpressionTest, ExpressionUsingAssignedMatrixTestSuccessful)
+{
+	Matrix matrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const Matrix other{
+		{ 1, 1 },
+		{ 1, 1 }
+	};
+
+	matrix = matrix * 2 + other - matrix;
+	const Matrix expected{
+		{ 2, 3 },
+		{ 4, 5 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+
+	// Assigned matrix of another size is replaced, not written over
+	Matrix<int> resized{ { 1 } };
+	resized = other + other;
+	const Matrix expectedResized{
+		{ 2, 2 },
+		{ 2, 2 }
+	};
+	EXPECT_THAT(resized, IsEqualMatrix(expectedResized));
+}
+TEST(MatrixExpressionTest, MixedTypesExpressionTestSuccessful)
+{
+	const Matrix<int> lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const MatrixD rMatrix{
+		{ 0.5, 0.25 },
+		{ 1.5, 2 }
+	};
+
+	const Matrix result = lMatrix + rMatrix / 2;
+	static_assert(std::is_same_v<std::remove_const_t<decltype(result)>, MatrixD>);
+	const MatrixD expected{
+		{ 1.25, 2.125 },
+		{ 3.75, 5 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixExpressionTest, ViewsExpressionTestSuccessful)
+{
+	const Matrix matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	const MatrixView topLeft{matrix, 0, 0, 2, 2};
+	const MatrixView bottomRight{matrix, 1, 1, 2, 2};
+
+	const Matrix result = topLeft * 10 + bottomRight;
+	const Matrix expected{
+		{ 15, 26 },
+		{ 48, 59 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixExpressionTest, DotProductOfExpressionsTestSuccessful)
+{
+	const Matrix lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const Matrix rMatrix{
+		{ 1, 0, 2 },
+		{ 0, 1, 3 }
+	};
+
+	const Matrix result = (lMatrix + lMatrix) * (rMatrix - 1);
+	const Matrix expected{
+		{ -4, -2, 10 },
+		{ -8, -6, 22 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixExpressionTest, DifferentSizesExpressionTestUnsuccessful)
+{
+	const Matrix lMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const Matrix rMatrix{
+		{ 1, 2, 3 }
+	};
+
+	// Sizes are checked when expression is built, not when it is evaluated
+	EXPECT_THROW({(void)(lMatrix * 2 + rMatrix);}, std::length_error);
+	EXPECT_THROW({(void)(lMatrix - (rMatrix + rMatrix));}, std::length_error);
+}
+TEST(StaticMatrixExpressionTest, StaticExpressionDeductionTestSuccessful)
+{
+	const SMatrix<int, 2, 3> lMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 }
+	};
+	const SMatrix<int, 2, 3> rMatrix{
+		{ 6, 5, 4 },
+		{ 3, 2, 1 }
+	};
+
+	const SMatrix result = lMatrix + rMatrix * 2;
+	static_assert(std::is_same_v<std::remove_const_t<decltype(result)>, SMatrix<int, 2, 3>>);
+	const SMatrix<int, 2, 3> expected{
+		{ 13, 12, 11 },
+		{ 10, 9, 8 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+
+	SMatrix<int, 2, 3> assigned{};
+	assigned = -Multiply(lMatrix, rMatrix);
+	const SMatrix<int, 2, 3> expectedAssigned{
+		{ -6, -10, -12 },
+		{ -12, -10, -6 }
+	};
+	EXPECT_THAT(assigned, IsEqualMatrix(expectedAssigned));
+}
@@ -1,4 +1,7 @@
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -8,6 +11,7 @@
 #include "unittest_common.h"
 #include "matrixes/matrix.h"
 #include "matrixes/operations.h"
+#include "matrixes/view.h"
 
 using namespace MxLib;
 
@@ -33,6 +37,109 @@ TEST(MatrixRandomizationTest, RandomizeRightRangeTestSuccessful_3)
 	EXPECT_THAT(toRandomize, IsMatrixValuesInRange(10, 11));
 }
 
+TEST(MatrixRandomizationTest, PhiloxKnownAnswerTestSuccessful)
+{
+	// Known answers of Philox4x32-10 from reference implementation of Random123
+	const std::uint32_t counters[3][4]{
+		{ 0, 0, 0, 0 },
+		{ 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff },
+		{ 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344 }
+	};
+	const std::uint32_t keys[3][2]{ { 0, 0 }, { 0xffffffff, 0xffffffff }, { 0xa4093822, 0x299f31d0 } };
+	const std::uint32_t expected[3][4]{
+		{ 0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+		{ 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+		{ 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 }
+	};
+	for (std::size_t test = 0; test < 3; ++test)
+	{
+		std::uint32_t block[4];
+		Philox4x32{keys[test][0], keys[test][1]}.Generate(counters[test], block);
+		for (std::size_t word = 0; word < 4; ++word)
+		{
+			EXPECT_EQ(block[word], expected[test][word]);
+		}
+	}
+}
+TEST(MatrixRandomizationTest, SeededRandomizeReproducibleTestSuccessful)
+{
+	MatrixD first{37, 29};
+	MatrixD second{37, 29};
+	Randomize(first, -2, 3, 42);
+	Randomize(second, -2, 3, 42);
+	EXPECT_THAT(first, IsMatrixValuesInRange(-2, 3));
+	EXPECT_THAT(second, IsEqualMatrix(first));
+
+	// Value of element depends only on its position, not on padding or storage of matrix
+	MatrixD padded{37, 29, RowPadding::CacheLine};
+	Randomize(padded, -2, 3, 42);
+	SMatrix<double, 37, 29> fixed;
+	Randomize(fixed, -2, 3, 42);
+	for (std::size_t row = 0; row < 37; ++row)
+	{
+		for (std::size_t col = 0; col < 29; ++col)
+		{
+			EXPECT_EQ(padded(row, col), first(row, col));
+			EXPECT_EQ(fixed(row, col), first(row, col));
+		}
+	}
+
+	Randomize(second, -2, 3, 43);
+	std::size_t equalCount = 0;
+	for (std::size_t row = 0; row < 37; ++row)
+	{
+		for (std::size_t col = 0; col < 29; ++col)
+		{
+			equalCount += second(row, col) == first(row, col);
+		}
+	}
+	EXPECT_EQ(equalCount, 0);
+}
+TEST(MatrixRandomizationTest, RandomizeIntegralTestSuccessful)
+{
+	Matrix<int> matrix{50, 50};
+	Randomize(matrix, -3, 3, 7);
+	std::size_t counts[7]{};
+	for (std::size_t row = 0; row < 50; ++row)
+	{
+		for (std::size_t col = 0; col < 50; ++col)
+		{
+			ASSERT_GE(matrix(row, col), -3);
+			ASSERT_LE(matrix(row, col), 3);
+			++counts[matrix(row, col) + 3];
+		}
+	}
+	// Every value is expected about 357 times
+	for (const std::size_t count : counts)
+	{
+		EXPECT_GT(count, 250);
+		EXPECT_LT(count, 470);
+	}
+
+	Matrix<std::uint64_t> full{3, 3};
+	Randomize(full, 0, std::numeric_limits<std::uint64_t>::max(), 7);
+	EXPECT_NE(full(0, 0), full(0, 1));
+}
+TEST(MatrixRandomizationTest, RandomizeNormalTestSuccessful)
+{
+	MatrixD matrix{200, 201};
+	RandomizeNormal(matrix, 2.0, 0.5, 11);
+	double sum = 0;
+	double squaresSum = 0;
+	for (std::size_t row = 0; row < 200; ++row)
+	{
+		for (std::size_t col = 0; col < 201; ++col)
+		{
+			sum += matrix(row, col);
+			squaresSum += matrix(row, col) * matrix(row, col);
+		}
+	}
+	const double count = 200.0 * 201.0;
+	const double mean = sum / count;
+	EXPECT_NEAR(mean, 2.0, 0.01);
+	EXPECT_NEAR(std::sqrt(squaresSum / count - mean * mean), 0.5, 0.01);
+}
+
 TEST(MatrixMultiplyTest, SimpleMatrixMultiplicationTestSuccessful)
 {
 	const Matrix leftMatrix
@@ -201,6 +308,397 @@ TEST(MatrixDotProductTest, DotProductOfDifferentMatrixesWithIncompatibleDimensio
 	EXPECT_THROW({(void)(lMatrix * rMatrix);}, std::length_error);
 }
 
+template<typename ResultT, typename LMatrix, typename RMatrix>
+static Matrix<ResultT> NaiveDotProduct(const LMatrix &lMatrix, const RMatrix &rMatrix)
+{
+	Matrix<ResultT> result{lMatrix.Rows(), rMatrix.Cols()};
+	for (std::size_t row = 0; row < lMatrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < rMatrix.Cols(); col++)
+		{
+			ResultT value{};
+			for (std::size_t iter = 0; iter < lMatrix.Cols(); iter++)
+			{
+				value += lMatrix(row, iter) * rMatrix(iter, col);
+			}
+			result(row, col) = value;
+		}
+	}
+	return result;
+}
+
+TEST(MatrixDotProductTest, LargeBlockedDotProductTestSuccessful)
+{
+	// Dimensions are not multiples of any block size to cover all edge panels
+	MatrixD lMatrix{157, 301};
+	MatrixD rMatrix{301, 143};
+	Randomize(lMatrix, -1, 1);
+	Randomize(rMatrix, -1, 1);
+
+	const Matrix result = lMatrix * rMatrix;
+	EXPECT_THAT(result, IsEqualMatrix(NaiveDotProduct<double>(lMatrix, rMatrix)));
+}
+TEST(MatrixDotProductTest, LargeBlockedFloatDotProductTestSuccessful)
+{
+	MatrixF lMatrix{70, 530};
+	MatrixF rMatrix{530, 33};
+	Randomize(lMatrix, -1, 1);
+	Randomize(rMatrix, -1, 1);
+
+	const Matrix result = lMatrix * rMatrix;
+	const Matrix expected = NaiveDotProduct<float>(lMatrix, rMatrix);
+	ASSERT_EQ(result.Rows(), expected.Rows());
+	ASSERT_EQ(result.Cols(), expected.Cols());
+	for (std::size_t row = 0; row < result.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < result.Cols(); col++)
+		{
+			EXPECT_NEAR(result(row, col), expected(row, col), 1e-3);
+		}
+	}
+}
+TEST(MatrixDotProductTest, LargeMixedTypesDotProductTestSuccessful)
+{
+	Matrix<int> lMatrix{65, 40};
+	MatrixD rMatrix{40, 70};
+	for (std::size_t row = 0; row < lMatrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < lMatrix.Cols(); col++)
+		{
+			lMatrix(row, col) = static_cast<int>(row * 3 + col) % 17 - 8;
+		}
+	}
+	Randomize(rMatrix, -5, 5);
+
+	const Matrix<double> result = lMatrix * rMatrix;
+	EXPECT_THAT(result, IsEqualMatrix(NaiveDotProduct<double>(lMatrix, rMatrix)));
+}
+TEST(MatrixDotProductTest, EmptyInnerDimensionDotProductTestSuccessful)
+{
+	const MatrixD lMatrix{3, 0};
+	const MatrixD rMatrix{0, 4};
+
+	const Matrix result = lMatrix * rMatrix;
+	MatrixD expected{3, 4};
+	SetAll(expected, 0);
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+
+TEST(MatrixDotProductTest, PaddedRowsDotProductTestSuccessful)
+{
+	constexpr std::size_t ROWS = 45;
+	constexpr std::size_t INNER = 37;
+	constexpr std::size_t COLS = 51;
+
+	// Small integer values keep float products exact
+	MatrixF lMatrix{ROWS, INNER, RowPadding::CacheLine};
+	MatrixF rMatrix{INNER, COLS, RowPadding::CacheLine};
+	for (std::size_t iter = 0; iter < INNER; ++iter)
+	{
+		for (std::size_t row = 0; row < ROWS; ++row)
+		{
+			lMatrix(row, iter) = static_cast<float>((row * 7 + iter * 3) % 5) - 2;
+		}
+		for (std::size_t col = 0; col < COLS; ++col)
+		{
+			rMatrix(iter, col) = static_cast<float>((iter * 5 + col) % 7) - 3;
+		}
+	}
+
+	const MatrixF result = lMatrix * rMatrix;
+	const MatrixD expected = MatrixD{lMatrix} * MatrixD{rMatrix};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+
+template<typename M>
+static M Transposed(const M &matrix)
+{
+	M transposed{matrix.Cols(), matrix.Rows()};
+	for (std::size_t row = 0; row < matrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < matrix.Cols(); col++)
+		{
+			transposed(col, row) = matrix(row, col);
+		}
+	}
+	return transposed;
+}
+
+TEST(MatrixGemmTest, AlphaBetaGemmTestSuccessful)
+{
+	const Matrix<int> aMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 }
+	};
+	const Matrix<int> bMatrix{
+		{ 1, 0 },
+		{ 0, 1 },
+		{ 1, 1 }
+	};
+	Matrix<int> cMatrix{
+		{ 1, 1 },
+		{ 2, 2 }
+	};
+	const int *storage = cMatrix.data();
+
+	Gemm(2, aMatrix, bMatrix, 3, cMatrix);
+	const Matrix<int> expected{
+		{ 11, 13 },
+		{ 26, 28 }
+	};
+	EXPECT_THAT(cMatrix, IsEqualMatrix(expected));
+	EXPECT_EQ(cMatrix.data(), storage);
+}
+TEST(MatrixGemmTest, ZeroBetaIgnoresOutputTestSuccessful)
+{
+	const MatrixD aMatrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	// Output is not read when beta is zero, so NaN in it doesn't spread
+	MatrixD cMatrix{2, 2};
+	SetAll(cMatrix, std::numeric_limits<double>::quiet_NaN());
+
+	MultiplyInto(aMatrix, aMatrix, cMatrix);
+	EXPECT_THAT(cMatrix, IsEqualMatrix(aMatrix * aMatrix));
+}
+TEST(MatrixGemmTest, TransposedOperandsGemmTestSuccessful)
+{
+	MatrixD aMatrix{7, 5};
+	MatrixD bMatrix{9, 7};
+	Randomize(aMatrix, -1, 1);
+	Randomize(bMatrix, -1, 1);
+
+	MatrixD result{5, 9};
+	MultiplyInto(aMatrix, bMatrix, result, Transposition::Transposed, Transposition::Transposed);
+	EXPECT_THAT(result, IsEqualMatrix(NaiveDotProduct<double>(Transposed(aMatrix), Transposed(bMatrix))));
+
+	MatrixD square{5, 5};
+	MultiplyInto(aMatrix, aMatrix, square, Transposition::Transposed);
+	EXPECT_THAT(square, IsEqualMatrix(NaiveDotProduct<double>(Transposed(aMatrix), aMatrix)));
+}
+TEST(MatrixGemmTest, LargeBlockedGemmTestSuccessful)
+{
+	MatrixD aMatrix{131, 257};
+	MatrixD bMatrix{113, 257};
+	MatrixD cMatrix{131, 113, RowPadding::CacheLine};
+	Randomize(aMatrix, -1, 1);
+	Randomize(bMatrix, -1, 1);
+	Randomize(cMatrix, -1, 1);
+
+	const MatrixD product = NaiveDotProduct<double>(aMatrix, Transposed(bMatrix));
+	MatrixD expected{cMatrix.Rows(), cMatrix.Cols()};
+	for (std::size_t row = 0; row < expected.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < expected.Cols(); col++)
+		{
+			expected(row, col) = 0.5 * product(row, col) - 2 * cMatrix(row, col);
+		}
+	}
+
+	Gemm(0.5, aMatrix, bMatrix, -2.0, cMatrix, Transposition::None, Transposition::Transposed);
+	EXPECT_THAT(cMatrix, IsEqualMatrix(expected));
+}
+TEST(MatrixGemmTest, StaticOutputGemmTestSuccessful)
+{
+	const Matrix3i aMatrix{
+		{ 1, 2, 0 },
+		{ 0, 1, 0 },
+		{ 2, 0, 1 }
+	};
+	Matrix3i cMatrix{
+		{ 1, 0, 0 },
+		{ 0, 1, 0 },
+		{ 0, 0, 1 }
+	};
+
+	Gemm(1, aMatrix, aMatrix, -1, cMatrix);
+	const Matrix3i expected{
+		{ 0, 4, 0 },
+		{ 0, 0, 0 },
+		{ 4, 4, 0 }
+	};
+	EXPECT_THAT(cMatrix, IsEqualMatrix(expected));
+}
+TEST(MatrixGemmTest, AliasedOutputGemmTestSuccessful)
+{
+	MatrixD matrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	const MatrixD expected = matrix * matrix;
+
+	MultiplyInto(matrix, matrix, matrix);
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+}
+TEST(MatrixGemmTest, StridedViewsGemmTestSuccessful)
+{
+	MatrixD viewedMatrix{90, 80, RowPadding::CacheLine};
+	Randomize(viewedMatrix, -1, 1);
+
+	const MatrixView aBlock{viewedMatrix, 2, 3, 41, 37};
+	const MatrixView bBlock{viewedMatrix, 45, 20, 37, 43};
+	const MatrixD expected = NaiveDotProduct<double>(MatrixD{aBlock}, MatrixD{bBlock});
+
+	MatrixD result{41, 43};
+	MultiplyInto(aBlock, bBlock, result);
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+	EXPECT_THAT(aBlock * bBlock, IsEqualMatrix(expected));
+
+	const MatrixView rows{bBlock, 0, 0, 4, 43};
+	const MatrixView columns{viewedMatrix, 40, 60, 43, 10};
+	const ColView column{columns, 5};
+	MatrixD vectorProduct{4, 1};
+	MultiplyInto(rows, column, vectorProduct);
+	EXPECT_THAT(vectorProduct, IsEqualMatrix(NaiveDotProduct<double>(MatrixD{rows}, MatrixD{column})));
+}
+TEST(MatrixGemmTest, ViewOfOutputGemmTestSuccessful)
+{
+	MatrixD matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	const MatrixD original{matrix};
+	const MatrixView topRows{matrix, 0, 0, 3, 3};
+
+	MultiplyInto(topRows, original, matrix);
+	EXPECT_THAT(matrix, IsEqualMatrix(NaiveDotProduct<double>(original, original)));
+}
+TEST(MatrixGemmTest, TransposeViewGemmTestSuccessful)
+{
+	MatrixD aMatrix{37, 29, RowPadding::CacheLine};
+	MatrixD bMatrix{37, 23};
+	Randomize(aMatrix, -1, 1);
+	Randomize(bMatrix, -1, 1);
+	const MatrixD expected = NaiveDotProduct<double>(Transposed(aMatrix), bMatrix);
+
+	const TransposeView aTransposed{aMatrix};
+	EXPECT_THAT(aTransposed * bMatrix, IsEqualMatrix(expected));
+
+	// View combined with transposition flag reads viewed matrix as it is stored
+	MatrixD square{37, 37};
+	MultiplyInto(aTransposed, aMatrix, square, Transposition::Transposed, Transposition::Transposed);
+	EXPECT_THAT(square, IsEqualMatrix(NaiveDotProduct<double>(aMatrix, Transposed(aMatrix))));
+
+	const MatrixView block{bMatrix, 3, 2, 20, 15};
+	const TransposeView blockTransposed{block};
+	MatrixD blockProduct{15, 29};
+	MultiplyInto(blockTransposed, MatrixView{aMatrix, 0, 0, 20, 29}, blockProduct);
+	EXPECT_THAT(blockProduct, IsEqualMatrix(NaiveDotProduct<double>(Transposed(MatrixD{block}), MatrixD{MatrixView{aMatrix, 0, 0, 20, 29}})));
+}
+TEST(MatrixGemmTest, StaticTransposeViewGemmTestSuccessful)
+{
+	const SMatrix<int, 2, 3> aMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 }
+	};
+	const SMatrix<int, 2, 2> bMatrix{
+		{ 1, 2 },
+		{ 0, 1 }
+	};
+	SMatrix<int, 3, 2> result{};
+	MultiplyInto(TransposeView{aMatrix}, bMatrix, result);
+	const SMatrix<int, 3, 2> expected{
+		{ 1, 6 },
+		{ 2, 9 },
+		{ 3, 12 }
+	};
+	EXPECT_THAT(result, IsEqualMatrix(expected));
+}
+TEST(MatrixGemmTest, WrongOutputDimensionsGemmTestUnsuccessful)
+{
+	const MatrixD aMatrix{2, 3};
+	const MatrixD bMatrix{3, 4};
+	MatrixD cMatrix{4, 2};
+
+	EXPECT_THROW({MultiplyInto(aMatrix, bMatrix, cMatrix);}, std::length_error);
+	EXPECT_THROW({MultiplyInto(aMatrix, bMatrix, cMatrix, Transposition::Transposed);}, std::length_error);
+}
+
+// Enables Strassen-Winograd recursion with small cutoff, so products in test take several levels
+class StrassenGemmTest :
+	public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_previousEnabled = strassen::Enabled();
+		m_previousCutoff = strassen::Cutoff();
+		strassen::SetEnabled(true);
+		strassen::SetCutoff(16);
+	}
+
+	void TearDown() override
+	{
+		strassen::SetEnabled(m_previousEnabled);
+		strassen::SetCutoff(m_previousCutoff);
+	}
+
+private:
+	bool m_previousEnabled{false};
+	std::size_t m_previousCutoff{strassen::DEFAULT_CUTOFF};
+};
+
+TEST_F(StrassenGemmTest, OddDimensionsProductTestSuccessful)
+{
+	// Odd dimensions are peeled off on different levels of recursion
+	MatrixD lMatrix{157, 131};
+	MatrixD rMatrix{131, 143};
+	Randomize(lMatrix, -1, 1, 1);
+	Randomize(rMatrix, -1, 1, 2);
+	ASSERT_TRUE(strassen::ShouldUse(157, 143, 131));
+
+	EXPECT_THAT(lMatrix * rMatrix, IsEqualMatrix(NaiveDotProduct<double>(lMatrix, rMatrix)));
+
+	MatrixF lFloat{64, 64};
+	MatrixF rFloat{64, 64};
+	Randomize(lFloat, -1, 1, 3);
+	Randomize(rFloat, -1, 1, 4);
+	const MatrixF product = lFloat * rFloat;
+	const MatrixF expected = NaiveDotProduct<float>(lFloat, rFloat);
+	for (std::size_t row = 0; row < 64; row++)
+	{
+		for (std::size_t col = 0; col < 64; col++)
+		{
+			EXPECT_NEAR(product(row, col), expected(row, col), 1e-4);
+		}
+	}
+}
+TEST_F(StrassenGemmTest, AlphaBetaTransposedGemmTestSuccessful)
+{
+	MatrixD aMatrix{97, 70};
+	MatrixD bMatrix{81, 97};
+	MatrixD cMatrix{70, 81, RowPadding::CacheLine};
+	Randomize(aMatrix, -1, 1, 5);
+	Randomize(bMatrix, -1, 1, 6);
+	Randomize(cMatrix, -1, 1, 7);
+
+	const MatrixD product = NaiveDotProduct<double>(Transposed(aMatrix), Transposed(bMatrix));
+	MatrixD expected{cMatrix.Rows(), cMatrix.Cols()};
+	for (std::size_t row = 0; row < expected.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < expected.Cols(); col++)
+		{
+			expected(row, col) = 1.5 * product(row, col) + 0.5 * cMatrix(row, col);
+		}
+	}
+
+	Gemm(1.5, aMatrix, bMatrix, 0.5, cMatrix, Transposition::Transposed, Transposition::Transposed);
+	EXPECT_THAT(cMatrix, IsEqualMatrix(expected));
+}
+TEST_F(StrassenGemmTest, DisabledOrSmallProductsTestSuccessful)
+{
+	EXPECT_FALSE(strassen::ShouldUse(15, 100, 100));
+	strassen::SetEnabled(false);
+	EXPECT_FALSE(strassen::ShouldUse(100, 100, 100));
+
+	// Integer products are never split
+	static_assert(!strassen::ApplicableT<int, int, int>);
+	static_assert(!strassen::ApplicableT<double, float, double>);
+	static_assert(strassen::ApplicableT<float, float, float>);
+}
+
 TEST(MatrixAdditionTest, MatrixAdditionTestSuccessful_1)
 {
 	const Matrix lMatrix{
@@ -219,6 +717,29 @@ TEST(MatrixAdditionTest, MatrixAdditionTestSuccessful_1)
 	};
 	EXPECT_THAT(result, IsEqualMatrix(expected));
 }
+TEST(MatrixAdditionTest, PaddedRowsAdditionTestSuccessful)
+{
+	constexpr std::size_t ROWS = 7;
+	constexpr std::size_t COLS = 21;
+
+	MatrixF padded{ROWS, COLS, RowPadding::CacheLine};
+	MatrixF dense{ROWS, COLS};
+	Randomize(padded, -5, 5);
+	Randomize(dense, -5, 5);
+	ASSERT_EQ(padded.RowStride(), 32);
+
+	MatrixF sum{ROWS, COLS, RowPadding::CacheLine};
+	sum = padded + dense;
+	const MatrixF scaled = padded * 2.0f - dense;
+	for (std::size_t row = 0; row < ROWS; ++row)
+	{
+		for (std::size_t col = 0; col < COLS; ++col)
+		{
+			EXPECT_FLOAT_EQ(sum(row, col), padded(row, col) + dense(row, col));
+			EXPECT_FLOAT_EQ(scaled(row, col), padded(row, col) * 2.0f - dense(row, col));
+		}
+	}
+}
 TEST(MatrixAdditionTest, EmptyMatrixAdditionTestSuccessful)
 {
 	const Matrix lMatrix{ { 0 } };
@@ -295,6 +816,40 @@ TEST(MatrixAdditionTest, MatrixSelfAssignmentAdditionTestSuccessful)
 	};
 	EXPECT_THAT(lMatrix, IsEqualMatrix(expected));
 }
+TEST(MatrixAdditionTest, TransposeSelfAssignmentAdditionTestSuccessful)
+{
+	Matrix matrix{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	matrix += TransposeView{matrix};
+	const Matrix expected{
+		{ 2, 5 },
+		{ 5, 8 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+
+	MatrixD large{20, 20, RowPadding::CacheLine};
+	for (std::size_t row = 0; row < large.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < large.Cols(); ++col)
+		{
+			large(row, col) = static_cast<double>(row * 20 + col);
+		}
+	}
+	const MatrixD original{large};
+	large -= TransposeView{large};
+	EXPECT_THAT(large, IsEqualMatrix(MatrixD{original - TransposeView{original}}));
+
+	Matrix3d staticMatrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	const Matrix3d staticOriginal{staticMatrix};
+	MultiplyInplace(staticMatrix, TransposeView{staticMatrix});
+	EXPECT_THAT(staticMatrix, IsEqualMatrix(Matrix3d{Multiply(staticOriginal, TransposeView{staticOriginal})}));
+}
 TEST(MatrixAdditionTest, EmptyMatrixAssignmentAdditionTestSuccessful)
 {
 	Matrix<int> lMatrix;
@@ -438,6 +993,34 @@ TEST(MatrixScalarMultiplication, ScalarMultiplicationTestSuccessful)
 	};
 	EXPECT_THAT(result, IsEqualMatrix(expected));
 }
+TEST(MatrixScalarMultiplication, MixedScalarInplaceMultiplicationTestSuccessful)
+{
+	MatrixF floats{37, 19};
+	Randomize(floats, -10.0f, 10.0f, 7);
+	MatrixF expected{floats.Rows(), floats.Cols()};
+	for (std::size_t row = 0; row < floats.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < floats.Cols(); ++col)
+		{
+			expected(row, col) = (floats(row, col) * 2.0f + 0.5f) / 4.0f;
+		}
+	}
+	floats *= 2.0;
+	floats += 0.5;
+	floats /= 4.0;
+	EXPECT_THAT(floats, IsEqualMatrix(expected));
+
+	Matrix<int> integers{
+		{ 3, 5 },
+		{ -3, 1 }
+	};
+	integers *= 2.5;
+	const Matrix<int> truncated{
+		{ 7, 12 },
+		{ -7, 2 }
+	};
+	EXPECT_THAT(integers, IsEqualMatrix(truncated));
+}
 TEST(MatrixScalarMultiplication, EmptyMatrixScalarMultiplicationTestSuccessful)
 {
 	const Matrix<int> lMatrix;
@@ -506,6 +1089,133 @@ TEST(MatrixScalarSubtraction, EmptyMatrixScalarSubtractionTestSuccessful)
 	EXPECT_THAT(result, IsEqualMatrix(expected));
 }
 
+TEST(MatrixScalarAssignment, ScalarAssignmentOperationsTestSuccessful)
+{
+	MatrixD matrix{
+		{ 1, 6 },
+		{ 8, 9 }
+	};
+	const double *storage = matrix.data();
+
+	((matrix *= 2) += 1.0) -= 3;
+	matrix /= 2;
+	const MatrixD expected{
+		{ 0, 5 },
+		{ 7, 8 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+	EXPECT_EQ(matrix.data(), storage);
+}
+TEST(MatrixScalarAssignment, IntegerScalarAssignmentTestSuccessful)
+{
+	Matrix<int> matrix{
+		{ 1, 6 },
+		{ 8, 9 }
+	};
+	matrix *= 3;
+	matrix /= 2;
+	matrix -= 1;
+	const Matrix<int> expected{
+		{ 0, 8 },
+		{ 11, 12 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+}
+TEST(MatrixScalarAssignment, PaddedRowsScalarAssignmentTestSuccessful)
+{
+	MatrixF matrix{5, 19, RowPadding::CacheLine};
+	MatrixF expected{5, 19};
+	for (std::size_t row = 0; row < matrix.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < matrix.Cols(); ++col)
+		{
+			matrix(row, col) = static_cast<float>(row * 19 + col);
+			expected(row, col) = static_cast<float>(row * 19 + col) * 4 + 2;
+		}
+	}
+
+	(matrix *= 4.0f) += 2.0f;
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+}
+TEST(MatrixScalarAssignment, StaticMatrixScalarAssignmentTestSuccessful)
+{
+	Matrix2d matrix{
+		{ 2, 4 },
+		{ 6, 8 }
+	};
+	matrix /= 2.0;
+	const Matrix2d expected{
+		{ 1, 2 },
+		{ 3, 4 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(expected));
+}
+TEST(MatrixElementwiseAssignment, ElementwiseMultiplyDivideTestSuccessful)
+{
+	MatrixD matrix{
+		{ 1, 6, 3 },
+		{ 8, 9, 2 }
+	};
+	const MatrixD other{
+		{ 2, 3, 0.5 },
+		{ 4, 1, 2 }
+	};
+
+	MultiplyInplace(matrix, other);
+	const MatrixD multiplied{
+		{ 2, 18, 1.5 },
+		{ 32, 9, 4 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(multiplied));
+
+	DivideInplace(matrix, other * 2.0);
+	const MatrixD divided{
+		{ 0.5, 3, 1.5 },
+		{ 4, 4.5, 1 }
+	};
+	EXPECT_THAT(matrix, IsEqualMatrix(divided));
+
+	const MatrixD quotient{Divide(multiplied, other)};
+	const MatrixD expectedQuotient{
+		{ 1, 6, 3 },
+		{ 8, 9, 2 }
+	};
+	EXPECT_THAT(quotient, IsEqualMatrix(expectedQuotient));
+}
+TEST(MatrixElementwiseAssignment, PaddedAndIntegerElementwiseTestSuccessful)
+{
+	MatrixF padded{3, 21, RowPadding::CacheLine};
+	MatrixF dense{3, 21};
+	Matrix<int> integers{3, 21};
+	for (std::size_t row = 0; row < padded.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < padded.Cols(); ++col)
+		{
+			padded(row, col) = static_cast<float>(row + col);
+			dense(row, col) = static_cast<float>(col % 4 + 1);
+			integers(row, col) = static_cast<int>(row + col);
+		}
+	}
+
+	MultiplyInplace(padded, dense);
+	MultiplyInplace(integers, dense);
+	for (std::size_t row = 0; row < padded.Rows(); ++row)
+	{
+		for (std::size_t col = 0; col < padded.Cols(); ++col)
+		{
+			EXPECT_EQ(padded(row, col), static_cast<float>((row + col) * (col % 4 + 1)));
+			EXPECT_EQ(integers(row, col), static_cast<int>((row + col) * (col % 4 + 1)));
+		}
+	}
+}
+TEST(MatrixElementwiseAssignment, DifferentMatrixesElementwiseTestUnsuccessful)
+{
+	MatrixD lMatrix{2, 3};
+	const MatrixD rMatrix{3, 2};
+	EXPECT_THROW({MultiplyInplace(lMatrix, rMatrix);}, std::length_error);
+	EXPECT_THROW({DivideInplace(lMatrix, rMatrix);}, std::length_error);
+}
+
 TEST(MatrixNegative, MatrixNegativeTestSuccessful)
 {
 	const Matrix lMatrix{
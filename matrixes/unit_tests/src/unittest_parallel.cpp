@@ -0,0 +1,276 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/operations.h"
+#include "matrixes/thread_pool.h"
+#include "matrixes/algorithms.h"
+#include "matrixes/sparse_matrix.h"
+#include "matrixes/vector.h"
+
+using namespace MxLib;
+
+// Forces every operation in test to be split between several threads
+class ParallelOperationsTest :
+	public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		m_previousThreads = parallel::ThreadsCount();
+		m_previousThreshold = parallel::ParallelThreshold();
+		parallel::SetThreadsCount(4);
+		parallel::SetParallelThreshold(0);
+	}
+
+	void TearDown() override
+	{
+		parallel::SetThreadsCount(m_previousThreads);
+		parallel::SetParallelThreshold(m_previousThreshold);
+	}
+
+private:
+	std::size_t m_previousThreads{1};
+	std::size_t m_previousThreshold{parallel::DEFAULT_PARALLEL_THRESHOLD};
+};
+
+TEST(ThreadPoolTest, EveryTaskRunsOnceTest)
+{
+	ThreadPool pool{4};
+	ASSERT_EQ(pool.ThreadsCount(), 4);
+
+	std::vector<std::atomic<int>> runs(1000);
+	for (int repeat = 0; repeat < 10; ++repeat)
+	{
+		pool.ParallelFor(runs.size(), [&runs](std::size_t task) { runs[task]++; });
+	}
+	for (const std::atomic<int> &taskRuns : runs)
+	{
+		EXPECT_EQ(taskRuns.load(), 10);
+	}
+}
+TEST(ThreadPoolTest, NestedParallelForRunsInlineTest)
+{
+	ThreadPool pool{3};
+
+	std::atomic<int> runs{0};
+	pool.ParallelFor(8, [&](std::size_t) {
+		pool.ParallelFor(8, [&runs](std::size_t) { runs++; });
+	});
+	EXPECT_EQ(runs.load(), 64);
+}
+TEST(ThreadPoolTest, NestedCallsOnSeveralPoolsRunInlineTest)
+{
+	ThreadPool outer{3};
+	ThreadPool inner{3};
+
+	// Call on another pool must not end the task on outer one, later nested call stays inline
+	std::atomic<int> runs{0};
+	outer.ParallelFor(8, [&](std::size_t) {
+		inner.ParallelFor(4, [&runs](std::size_t) { runs++; });
+		outer.ParallelFor(4, [&runs](std::size_t) { runs++; });
+	});
+	EXPECT_EQ(runs.load(), 64);
+}
+TEST(ThreadPoolTest, TaskExceptionIsRethrownTest)
+{
+	ThreadPool pool{4};
+
+	std::atomic<int> runs{0};
+	EXPECT_THROW(pool.ParallelFor(100, [&runs](std::size_t task) {
+		runs++;
+		if (task == 42)
+		{
+			throw std::runtime_error{"Task failed"};
+		}
+	}), std::runtime_error);
+	EXPECT_EQ(runs.load(), 100);
+}
+TEST(ThreadPoolTest, SingleThreadPoolRunsOnCallerTest)
+{
+	ThreadPool pool{1};
+	ASSERT_EQ(pool.ThreadsCount(), 1);
+
+	const std::thread::id caller{std::this_thread::get_id()};
+	pool.ParallelFor(5, [&caller](std::size_t) { EXPECT_EQ(std::this_thread::get_id(), caller); });
+}
+
+TEST_F(ParallelOperationsTest, ParallelDotProductMatchesSingleThreadedTest)
+{
+	MatrixD lMatrix{203, 177};
+	MatrixD rMatrix{177, 191};
+	Randomize(lMatrix, -1, 1);
+	Randomize(rMatrix, -1, 1);
+
+	const Matrix parallelResult = lMatrix * rMatrix;
+	parallel::SetThreadsCount(1);
+	const Matrix singleResult = lMatrix * rMatrix;
+
+	EXPECT_THAT(parallelResult, IsEqualMatrix(singleResult));
+}
+TEST_F(ParallelOperationsTest, ParallelIntegerDotProductMatchesSingleThreadedTest)
+{
+	const Matrix<long> lMatrix = IndexedMatrix<long>(97, 64);
+	Matrix<long> rMatrix{64, 33};
+	for (std::size_t row = 0; row < rMatrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < rMatrix.Cols(); col++)
+		{
+			rMatrix(row, col) = static_cast<long>(row + col * 5) % 13 - 6;
+		}
+	}
+
+	const Matrix parallelResult = lMatrix * rMatrix;
+	parallel::SetThreadsCount(1);
+	const Matrix singleResult = lMatrix * rMatrix;
+
+	EXPECT_THAT(parallelResult, IsEqualMatrix(singleResult));
+}
+TEST_F(ParallelOperationsTest, ParallelElementwiseOperationsTest)
+{
+	MatrixD lMatrix{131, 67};
+	MatrixD rMatrix{131, 67};
+	Randomize(lMatrix, -1, 1);
+	Randomize(rMatrix, -1, 1);
+
+	const MatrixD sum = lMatrix + rMatrix;
+	const MatrixD difference = lMatrix - rMatrix;
+	const MatrixD product = Multiply(lMatrix, rMatrix);
+	const MatrixD scaled = lMatrix * 3.0;
+	for (std::size_t row = 0; row < lMatrix.Rows(); row++)
+	{
+		for (std::size_t col = 0; col < lMatrix.Cols(); col++)
+		{
+			EXPECT_DOUBLE_EQ(sum(row, col), lMatrix(row, col) + rMatrix(row, col));
+			EXPECT_DOUBLE_EQ(difference(row, col), lMatrix(row, col) - rMatrix(row, col));
+			EXPECT_DOUBLE_EQ(product(row, col), lMatrix(row, col) * rMatrix(row, col));
+			EXPECT_DOUBLE_EQ(scaled(row, col), lMatrix(row, col) * 3.0);
+		}
+	}
+}
+// Rows of different length are split between threads by amount of their elements
+TEST_F(ParallelOperationsTest, SparseProductsTestSuccessful)
+{
+	SparseMatrixBuilder<double> builder{300, 200};
+	MatrixD dense{300, 200};
+	for (std::size_t row = 0; row < 300; ++row)
+	{
+		for (std::size_t col = 0; col < 200; ++col)
+		{
+			const bool stored = col == row % 200 || (row % 50 == 7 && col % 2 == 0);
+			dense(row, col) = stored ? static_cast<double>((row + col) % 9) - 4 : 0;
+			if (stored)
+			{
+				builder.Add(row, col, dense(row, col));
+			}
+		}
+	}
+	const SparseMatrix<double> sparse = builder.Build();
+
+	VectorD vector(200);
+	MatrixD column{200, 1};
+	for (std::size_t index = 0; index < 200; ++index)
+	{
+		vector[index] = static_cast<double>(index % 11) - 5;
+		column(index, 0) = vector[index];
+	}
+	const VectorD product = sparse * vector;
+	const MatrixD expected = dense * column;
+	for (std::size_t row = 0; row < 300; ++row)
+	{
+		EXPECT_NEAR(product[row], expected(row, 0), 1e-9);
+	}
+
+	const MatrixView right{dense, 0, 0, 200, 30};
+	EXPECT_THAT(sparse * right, IsEqualMatrix(dense * MatrixD{right}));
+}
+// Values of elements don't depend on how rows are split between threads
+TEST_F(ParallelOperationsTest, SeededRandomizeMatchesSingleThreadedTest)
+{
+	MatrixF uniform{301, 77};
+	MatrixD normal{301, 77, RowPadding::CacheLine};
+	Matrix<int> integral{301, 77};
+	Randomize(uniform, -1, 1, 2024);
+	RandomizeNormal(normal, 0, 1, 2024);
+	Randomize(integral, -100, 100, 2024);
+
+	parallel::SetThreadsCount(1);
+	MatrixF singleUniform{301, 77};
+	MatrixD singleNormal{301, 77};
+	Matrix<int> singleIntegral{301, 77};
+	Randomize(singleUniform, -1, 1, 2024);
+	RandomizeNormal(singleNormal, 0, 1, 2024);
+	Randomize(singleIntegral, -100, 100, 2024);
+	for (std::size_t row = 0; row < 301; ++row)
+	{
+		for (std::size_t col = 0; col < 77; ++col)
+		{
+			EXPECT_EQ(uniform(row, col), singleUniform(row, col));
+			EXPECT_EQ(normal(row, col), singleNormal(row, col));
+			EXPECT_EQ(integral(row, col), singleIntegral(row, col));
+		}
+	}
+}
+// Tall matrixes are split between threads by rows, wide transposed ones by elements of output
+TEST_F(ParallelOperationsTest, ParallelGemvTestSuccessful)
+{
+	MatrixD matrix{517, 61};
+	Randomize(matrix, -1, 1, 17);
+	VectorD x(61);
+	VectorD y(517);
+	for (std::size_t index = 0; index < 517; ++index)
+	{
+		y[index] = static_cast<double>(index % 7) - 3;
+	}
+	for (std::size_t index = 0; index < 61; ++index)
+	{
+		x[index] = y[index];
+	}
+
+	const VectorD product = matrix * x;
+	const VectorD transposedProduct = y * matrix;
+	for (std::size_t row = 0; row < 517; ++row)
+	{
+		double expected = 0;
+		for (std::size_t col = 0; col < 61; ++col)
+		{
+			expected += matrix(row, col) * x[col];
+		}
+		EXPECT_NEAR(product[row], expected, 1e-12);
+	}
+	for (std::size_t col = 0; col < 61; ++col)
+	{
+		double expected = 0;
+		for (std::size_t row = 0; row < 517; ++row)
+		{
+			expected += y[row] * matrix(row, col);
+		}
+		EXPECT_NEAR(transposedProduct[col], expected, 1e-12);
+	}
+}
+// Every element is mapped exactly once whichever way rows are split
+TEST_F(ParallelOperationsTest, ParallelMapTestSuccessful)
+{
+	MatrixD matrix{123, 45, RowPadding::CacheLine};
+	Randomize(matrix, -1, 1, 9);
+
+	for (const algo::Execution execution : {algo::Execution::Auto, algo::Execution::Sequential, algo::Execution::Parallel})
+	{
+		std::atomic<std::size_t> calls{0};
+		const MatrixD mapped = algo::Map(matrix, [&calls](double value) {
+			calls.fetch_add(1, std::memory_order_relaxed);
+			return 2 * value + 1;
+		}, execution);
+		EXPECT_EQ(calls.load(), 123 * 45);
+		EXPECT_THAT(mapped, IsEqualMatrix(matrix * 2.0 + 1.0));
+	}
+
+	// Parallel execution splits rows even below parallel threshold
+	parallel::SetParallelThreshold(parallel::DEFAULT_PARALLEL_THRESHOLD);
+	MatrixD counted{64, 2};
+	SetAll(counted, 0.0);
+	algo::MapInplace(counted, [](double &value) { value += 1; }, algo::Execution::Parallel);
+	EXPECT_THAT(counted, IsMatrixValuesInRange(1, 1));
+}
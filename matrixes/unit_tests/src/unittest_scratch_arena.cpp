@@ -0,0 +1,118 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/algorithms.h"
+#include "matrixes/scratch_arena.h"
+
+using namespace MxLib;
+using namespace MxLib::algo;
+
+TEST(ScratchArenaTest, AlignedAllocationsTestSuccessful)
+{
+	ScratchArena arena{256};
+	EXPECT_EQ(arena.Capacity(), 0);
+
+	const char *first = arena.Allocate<char>(3);
+	const double *second = arena.Allocate<double>(5);
+	const float *third = arena.Allocate<float>(100);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % CACHE_LINE_SIZE, 0);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % CACHE_LINE_SIZE, 0);
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(third) % CACHE_LINE_SIZE, 0);
+	EXPECT_NE(static_cast<const void *>(first), static_cast<const void *>(second));
+
+	EXPECT_EQ(arena.Allocate<int>(0), nullptr);
+}
+TEST(ScratchArenaTest, ScopeRewindTestSuccessful)
+{
+	ScratchArena arena{1024};
+	const int *outer = arena.Allocate<int>(4);
+
+	const int *scoped{nullptr};
+	{
+		const ScratchArena::Scope scope{arena};
+		scoped = arena.Allocate<int>(16);
+		// Allocation that doesn't fit into first block takes new one
+		(void)arena.Allocate<double>(1000);
+	}
+	const std::size_t grownCapacity = arena.Capacity();
+	EXPECT_GT(grownCapacity, 1024);
+
+	// Memory taken after scope was opened is given again, blocks are kept
+	{
+		const ScratchArena::Scope scope{arena};
+		EXPECT_EQ(arena.Allocate<int>(16), scoped);
+		(void)arena.Allocate<double>(1000);
+	}
+	EXPECT_EQ(arena.Capacity(), grownCapacity);
+	EXPECT_NE(arena.Allocate<int>(4), outer);
+
+	arena.Release();
+	EXPECT_EQ(arena.Capacity(), 0);
+}
+TEST(ScratchArenaTest, SteadyStateAlgorithmsTestSuccessful)
+{
+	constexpr std::size_t RANK = 24;
+
+	MatrixD matrix{RANK};
+	for (std::size_t row = 0; row < RANK; ++row)
+	{
+		for (std::size_t col = 0; col < RANK; ++col)
+		{
+			matrix(row, col) = row == col ? RANK * 2.0 : static_cast<double>((row * 3 + col) % 7) - 3;
+		}
+	}
+	const Matrix<int> integers{
+		{ 2, 0, 1 },
+		{ 1, 3, 2 },
+		{ 1, 1, 2 }
+	};
+
+	ScratchArena arena{64};
+	MatrixD inversed{RANK};
+	const auto run = [&] {
+		(void)Determinant(matrix, arena);
+		(void)Determinant(integers, arena);
+		(void)Adjoint(integers, arena);
+		Inverse(matrix, inversed, arena);
+		(void)Inverse(integers, arena);
+	};
+
+	run();
+	const std::size_t capacity = arena.Capacity();
+	for (int iter = 0; iter < 10; ++iter)
+	{
+		run();
+	}
+	EXPECT_EQ(arena.Capacity(), capacity);
+
+	EXPECT_NEAR(Determinant(matrix, arena), Determinant(LU(matrix)), 1e-6 * std::abs(Determinant(LU(matrix))));
+	EXPECT_EQ(Determinant(integers, arena), 6);
+	EXPECT_THAT(Inverse(matrix), IsEqualMatrix(inversed));
+}
+TEST(ScratchArenaTest, MatrixInArenaTestSuccessful)
+{
+	ScratchArena arena;
+	const ScratchArena::Scope scope{arena};
+
+	const Matrix<double, ScratchAllocator<double>> matrix{
+		{
+			{ 7, 8, 9 },
+			{ 6, 5, 4 },
+			{ 3, 2, 2 }
+		},
+		ScratchAllocator<double>{arena}
+	};
+	Matrix<double, ScratchAllocator<double>> inversed{3, 3, ScratchAllocator<double>{arena}};
+	Inverse(matrix, inversed, arena);
+
+	const MatrixD expected{
+		{ -2/13.0, -2/13.0, 1 },
+		{ 0, 1, -2 },
+		{ 3/13.0, -10/13.0, 1 }
+	};
+	EXPECT_THAT(inversed, IsEqualMatrix(expected));
+	EXPECT_EQ(&inversed.get_allocator().Arena(), &arena);
+}
@@ -0,0 +1,169 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/operations.h"
+#include "matrixes/view.h"
+#include "matrixes/serialization.h"
+#include "matrixes/streaming.h"
+#include "matrixes/vector.h"
+
+using namespace MxLib;
+
+template<typename T>
+static Matrix<T> IndexMatrix(std::size_t rows, std::size_t cols, RowPadding padding = RowPadding::None)
+{
+	Matrix<T> matrix{rows, cols, padding};
+	for (std::size_t row = 0; row < rows; ++row)
+	{
+		for (std::size_t col = 0; col < cols; ++col)
+		{
+			matrix(row, col) = static_cast<T>(row * cols + col) - static_cast<T>(7);
+		}
+	}
+	return matrix;
+}
+
+TEST(SerializationTest, SaveLoadMatrixTestSuccessful)
+{
+	const TemporaryFile file{"save_load.mxm"};
+	const MatrixD matrix = IndexMatrix<double>(45, 33);
+	Save(file.Path(), matrix);
+	EXPECT_EQ(std::filesystem::file_size(file.Path()), sizeof(MatrixFileHeader) + 45 * 33 * sizeof(double));
+	EXPECT_THAT(Load<MatrixD>(file.Path()), IsEqualMatrix(matrix));
+
+	// Rows are stored without padding whatever layout of saved and loaded matrixes is
+	const Matrix<int> padded = IndexMatrix<int>(19, 5, RowPadding::CacheLine);
+	Save(file.Path(), padded);
+	EXPECT_EQ(std::filesystem::file_size(file.Path()), sizeof(MatrixFileHeader) + 19 * 5 * sizeof(int));
+	EXPECT_THAT(Load<Matrix<int>>(file.Path()), IsEqualMatrix(padded));
+
+	// Views and expressions are saved as matrixes they evaluate to
+	Save(file.Path(), ColView{matrix, 4});
+	EXPECT_THAT(Load<MatrixD>(file.Path()), IsEqualMatrix(MatrixD{ColView{matrix, 4}}));
+	Save(file.Path(), matrix + matrix);
+	EXPECT_THAT(Load<MatrixD>(file.Path()), IsEqualMatrix(matrix * 2.0));
+}
+
+TEST(SerializationTest, SaveLoadStaticMatrixTestSuccessful)
+{
+	const TemporaryFile file{"static.mxm"};
+	const Matrix3f matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9.5f }
+	};
+	Save(file.Path(), matrix);
+	EXPECT_THAT(Load<Matrix3f>(file.Path()), IsEqualMatrix(matrix));
+	EXPECT_THAT(Load<MatrixF>(file.Path()), IsEqualMatrix(matrix));
+
+	EXPECT_THROW((void)Load<Matrix4f>(file.Path()), std::length_error);
+	EXPECT_THROW((void)Load<Matrix3d>(file.Path()), std::runtime_error);
+}
+
+TEST(SerializationTest, LoadMappedTestSuccessful)
+{
+	const TemporaryFile file{"mapped.mxm"};
+	const MatrixF matrix = IndexMatrix<float>(300, 70);
+	Save(file.Path(), matrix);
+
+	const MappedMatrix<float> mapped = LoadMapped<float>(file.Path());
+	EXPECT_EQ(reinterpret_cast<std::uintptr_t>(mapped.data()) % CACHE_LINE_SIZE, 0);
+	EXPECT_THAT(mapped, IsEqualMatrix(matrix));
+
+	// Elements written through mapping are loaded afterwards
+	{
+		MappedMatrix<float> writable = LoadMapped<float>(file.Path(), MapMode::ReadWrite);
+		writable(299, 69) = -1;
+	}
+	EXPECT_EQ((Load<MatrixF>(file.Path())(299, 69)), -1);
+}
+
+TEST(SerializationTest, DamagedFilesTestFailure)
+{
+	const TemporaryFile file{"damaged.mxm"};
+	EXPECT_THROW((void)Load<MatrixD>(file.Path()), std::system_error);
+
+	{
+		std::ofstream stream{file.Path(), std::ios::binary};
+		stream << "Not a matrix file, but long enough to have header of matrix file in it............";
+	}
+	EXPECT_THROW((void)Load<MatrixD>(file.Path()), std::runtime_error);
+
+	Save(file.Path(), IndexMatrix<double>(10, 10));
+	std::filesystem::resize_file(file.Path(), sizeof(MatrixFileHeader) + 99 * sizeof(double));
+	EXPECT_THROW((void)Load<MatrixD>(file.Path()), std::length_error);
+	EXPECT_THROW((void)LoadMapped<double>(file.Path()), std::length_error);
+
+	std::filesystem::resize_file(file.Path(), sizeof(MatrixFileHeader) / 2);
+	EXPECT_THROW((void)Load<MatrixD>(file.Path()), std::runtime_error);
+}
+
+// Chunks of 7 rows don't divide 45 rows, so the last chunk is partial
+TEST(StreamingTest, StreamingGemvTestSuccessful)
+{
+	const TemporaryFile file{"streaming.mxm"};
+	const MatrixD matrix = IndexMatrix<double>(45, 33) * 0.25;
+	Save(file.Path(), matrix);
+	const std::size_t chunkBytes = 7 * 33 * sizeof(double);
+
+	const RowChunkStream<double> stream{file.Path(), chunkBytes};
+	EXPECT_EQ(stream.ChunkRows(), 7);
+	std::size_t nextRow = 0;
+	stream.ForEachChunk([&](std::size_t rowStart, std::size_t rowEnd, const double *rows) {
+		EXPECT_EQ(rowStart, nextRow);
+		EXPECT_EQ(rows[0], matrix(rowStart, 0));
+		EXPECT_EQ(rows[(rowEnd - rowStart) * 33 - 1], matrix(rowEnd - 1, 32));
+		nextRow = rowEnd;
+	});
+	EXPECT_EQ(nextRow, 45);
+
+	VectorD x(33);
+	for (std::size_t col = 0; col < 33; ++col)
+	{
+		x[col] = static_cast<double>(col % 5) - 2;
+	}
+	const VectorD product = StreamingGemv(file.Path(), x, Transposition::None, chunkBytes);
+	ASSERT_EQ(product.size(), 45);
+	for (std::size_t row = 0; row < 45; ++row)
+	{
+		double expected = 0;
+		for (std::size_t col = 0; col < 33; ++col)
+		{
+			expected += matrix(row, col) * x[col];
+		}
+		EXPECT_NEAR(product[row], expected, 1e-9);
+	}
+
+	VectorD y(45);
+	for (std::size_t row = 0; row < 45; ++row)
+	{
+		y[row] = static_cast<double>(row % 3) - 1;
+	}
+	const VectorD transposedProduct = StreamingGemv(file.Path(), y, Transposition::Transposed, chunkBytes);
+	ASSERT_EQ(transposedProduct.size(), 33);
+	for (std::size_t col = 0; col < 33; ++col)
+	{
+		double expected = 0;
+		for (std::size_t row = 0; row < 45; ++row)
+		{
+			expected += matrix(row, col) * y[row];
+		}
+		EXPECT_NEAR(transposedProduct[col], expected, 1e-9);
+	}
+
+	// Whole matrix in single chunk gives the same result
+	const VectorD singleChunk = StreamingGemv(file.Path(), x);
+	for (std::size_t row = 0; row < 45; ++row)
+	{
+		EXPECT_NEAR(singleChunk[row], product[row], 1e-9);
+	}
+
+	EXPECT_THROW((void)StreamingGemv(file.Path(), y), std::length_error);
+	EXPECT_THROW((void)StreamingGemv(file.Path(), x, Transposition::Transposed), std::length_error);
+}
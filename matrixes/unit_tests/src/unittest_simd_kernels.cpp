@@ -0,0 +1,203 @@
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+#include "unittest_common.h"
+#include "matrixes/simd.h"
+#include "matrixes/gemm.h"
+
+using namespace MxLib;
+
+// Every instruction set that current CPU can execute, including scalar reference one
+static std::vector<simd::Isa> SupportedIsas()
+{
+	std::vector<simd::Isa> isas;
+	for (const simd::Isa isa : {simd::Isa::Scalar, simd::Isa::SSE42, simd::Isa::AVX2, simd::Isa::AVX512})
+	{
+		if (isa <= simd::DetectIsa())
+		{
+			isas.push_back(isa);
+		}
+	}
+	return isas;
+}
+
+template<typename T>
+static std::vector<T> RandomValues(std::size_t count, unsigned seed)
+{
+	std::mt19937 generator{seed};
+	std::uniform_real_distribution<T> distribution{T{0.5}, T{2}};
+
+	std::vector<T> values(count);
+	for (T &value : values)
+	{
+		value = distribution(generator);
+	}
+	return values;
+}
+
+template<typename T>
+static void ExpectKernelsMatchScalar(simd::Isa isa)
+{
+	const simd::Kernels<T> &reference{simd::GetKernels<T>(simd::Isa::Scalar)};
+	const simd::Kernels<T> &tested{simd::GetKernels<T>(isa)};
+	const double accuracy = std::is_same_v<T, float> ? 1e-4 : 1e-10;
+
+	// Sizes around vector widths check both vector body and scalar tail
+	for (const std::size_t count : std::initializer_list<std::size_t>{0, 1, 3, 7, 8, 15, 16, 17, 33, 64, 1001})
+	{
+		const std::vector<T> lhs{RandomValues<T>(count, 1)};
+		const std::vector<T> rhs{RandomValues<T>(count, 2)};
+		const T scalar{T{1.75}};
+
+		std::vector<T> expected(count);
+		std::vector<T> result(count);
+
+		using BinaryKernel = void (*)(const T *, const T *, T *, std::size_t) noexcept;
+		for (const auto kernel : {&simd::Kernels<T>::add, &simd::Kernels<T>::subtract,
+			&simd::Kernels<T>::multiply, &simd::Kernels<T>::divide})
+		{
+			const BinaryKernel expectedKernel{reference.*kernel};
+			const BinaryKernel testedKernel{tested.*kernel};
+			expectedKernel(lhs.data(), rhs.data(), expected.data(), count);
+			testedKernel(lhs.data(), rhs.data(), result.data(), count);
+			EXPECT_THAT(result, testing::Pointwise(testing::DoubleNear(accuracy), expected));
+		}
+
+		using ScalarKernel = void (*)(const T *, T, T *, std::size_t) noexcept;
+		for (const auto kernel : {&simd::Kernels<T>::addScalar, &simd::Kernels<T>::subtractScalar,
+			&simd::Kernels<T>::multiplyScalar, &simd::Kernels<T>::divideScalar})
+		{
+			const ScalarKernel expectedKernel{reference.*kernel};
+			const ScalarKernel testedKernel{tested.*kernel};
+			expectedKernel(lhs.data(), scalar, expected.data(), count);
+			testedKernel(lhs.data(), scalar, result.data(), count);
+			EXPECT_THAT(result, testing::Pointwise(testing::DoubleNear(accuracy), expected));
+		}
+
+		EXPECT_NEAR(tested.dot(lhs.data(), rhs.data(), count),
+			reference.dot(lhs.data(), rhs.data(), count), accuracy * static_cast<double>(count + 1));
+	}
+}
+
+// Transpose only moves values, so results should be exactly the same
+template<typename T>
+static void ExpectTransposeTileMatchesScalar(simd::Isa isa)
+{
+	constexpr std::size_t TILE = simd::TRANSPOSE_TILE;
+	constexpr std::size_t IN_STRIDE = TILE + 5;
+	constexpr std::size_t OUT_STRIDE = TILE + 2;
+
+	const std::vector<T> input{RandomValues<T>(TILE * IN_STRIDE, 6)};
+	std::vector<T> expected(TILE * OUT_STRIDE, T{-1});
+	std::vector<T> result(TILE * OUT_STRIDE, T{-1});
+	simd::GetKernels<T>(simd::Isa::Scalar).transposeTile(input.data(), IN_STRIDE, expected.data(), OUT_STRIDE);
+	simd::GetKernels<T>(isa).transposeTile(input.data(), IN_STRIDE, result.data(), OUT_STRIDE);
+	EXPECT_EQ(result, expected);
+	EXPECT_EQ(expected[OUT_STRIDE + 1], input[IN_STRIDE + 1]);
+	EXPECT_EQ(expected[3 * OUT_STRIDE + 5], input[5 * IN_STRIDE + 3]);
+}
+
+template<typename T>
+static void ExpectMicroKernelMatchesScalar(simd::Isa isa)
+{
+	using Blocking = detail::GemmBlocking<T>;
+	constexpr std::size_t MR = Blocking::MR;
+	constexpr std::size_t NR = Blocking::NR;
+	constexpr std::size_t KC = 37;
+	constexpr std::size_t C_STRIDE = NR + 3;
+
+	const simd::MicroKernelFunc<T> reference{simd::GetMicroKernel<T, MR, NR>(simd::Isa::Scalar)};
+	const simd::MicroKernelFunc<T> tested{simd::GetMicroKernel<T, MR, NR>(isa)};
+	const double accuracy = std::is_same_v<T, float> ? 1e-3 : 1e-10;
+
+	const std::vector<T> packedA{RandomValues<T>(KC * MR, 3)};
+	const std::vector<T> packedB{RandomValues<T>(KC * NR, 4)};
+	const std::vector<T> initialC{RandomValues<T>(MR * C_STRIDE, 5)};
+
+	// Full tile and partial edge tile, both overwriting and accumulating
+	for (const auto &[rows, cols] : {std::pair{MR, NR}, std::pair{MR - 1, NR - 3}})
+	{
+		for (const bool accumulate : {false, true})
+		{
+			std::vector<T> expected{initialC};
+			std::vector<T> result{initialC};
+			reference(KC, packedA.data(), packedB.data(), expected.data(), C_STRIDE, rows, cols, accumulate);
+			tested(KC, packedA.data(), packedB.data(), result.data(), C_STRIDE, rows, cols, accumulate);
+			EXPECT_THAT(result, testing::Pointwise(testing::DoubleNear(accuracy), expected));
+		}
+	}
+}
+
+template<typename T>
+static void ExpectBatchProductMatchesScalar(simd::Isa isa)
+{
+	constexpr std::size_t COUNT = 45;
+	constexpr std::size_t LANE_STRIDE = 48;
+
+	const std::vector<T> lhs{RandomValues<T>(4 * 3 * LANE_STRIDE, 7)};
+	const std::vector<T> rhs{RandomValues<T>(3 * 4 * LANE_STRIDE, 8)};
+	std::vector<T> expected(4 * 4 * LANE_STRIDE, T{-1});
+	std::vector<T> result(4 * 4 * LANE_STRIDE, T{-1});
+	simd::GetBatchProduct<T, 4, 3, 4>(simd::Isa::Scalar)(lhs.data(), rhs.data(), expected.data(), LANE_STRIDE, COUNT);
+	simd::GetBatchProduct<T, 4, 3, 4>(isa)(lhs.data(), rhs.data(), result.data(), LANE_STRIDE, COUNT);
+	const double accuracy = std::is_same_v<T, float> ? 1e-5 : 1e-12;
+	EXPECT_THAT(result, testing::Pointwise(testing::DoubleNear(accuracy), expected));
+	// Elements after count are left as they were
+	EXPECT_EQ(result[COUNT], T{-1});
+}
+
+TEST(SimdKernelsTest, ActiveIsaIsSupportedTest)
+{
+	EXPECT_LE(simd::ActiveIsa(), simd::DetectIsa());
+}
+TEST(SimdKernelsTest, FloatKernelsMatchScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectKernelsMatchScalar<float>(isa);
+	}
+}
+TEST(SimdKernelsTest, DoubleKernelsMatchScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectKernelsMatchScalar<double>(isa);
+	}
+}
+TEST(SimdKernelsTest, FloatMicroKernelMatchesScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectMicroKernelMatchesScalar<float>(isa);
+	}
+}
+TEST(SimdKernelsTest, DoubleMicroKernelMatchesScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectMicroKernelMatchesScalar<double>(isa);
+	}
+}
+TEST(SimdKernelsTest, TransposeTileMatchesScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectTransposeTileMatchesScalar<float>(isa);
+		ExpectTransposeTileMatchesScalar<double>(isa);
+	}
+}
+TEST(SimdKernelsTest, BatchProductMatchesScalarReferenceTest)
+{
+	for (const simd::Isa isa : SupportedIsas())
+	{
+		SCOPED_TRACE(static_cast<int>(isa));
+		ExpectBatchProductMatchesScalar<float>(isa);
+		ExpectBatchProductMatchesScalar<double>(isa);
+	}
+}
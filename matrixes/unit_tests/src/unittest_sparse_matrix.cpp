@@ -0,0 +1,102 @@
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "unittest_common.h"
+#include "matrixes/matrix.h"
+#include "matrixes/operations.h"
+#include "matrixes/view.h"
+#include "matrixes/vector.h"
+#include "matrixes/sparse_matrix.h"
+
+using namespace MxLib;
+
+// Band of three diagonals with few long rows, like graph with hubs
+static MatrixD SparseLikeMatrix(std::size_t rows, std::size_t cols)
+{
+	MatrixD matrix{rows, cols};
+	for (std::size_t row = 0; row < rows; ++row)
+	{
+		for (std::size_t col = 0; col < cols; ++col)
+		{
+			const bool band = col + 1 >= row && col <= row + 1;
+			const bool hub = row % 17 == 3 && col % 3 == 0;
+			matrix(row, col) = band || hub ? static_cast<double>((row * 5 + col) % 9) - 4 : 0;
+		}
+	}
+	return matrix;
+}
+
+TEST(SparseMatrixTest, DenseConversionTestSuccessful)
+{
+	const MatrixD dense = SparseLikeMatrix(40, 30);
+	const SparseMatrix<double> sparse = SparseMatrix<double>::FromDense(dense);
+	EXPECT_EQ(sparse.Rows(), 40);
+	EXPECT_EQ(sparse.Cols(), 30);
+	EXPECT_EQ(sparse.RowOffsets().size(), 41);
+	EXPECT_LT(sparse.NonZeros(), dense.size() / 4);
+
+	EXPECT_THAT(sparse, IsEqualMatrix(dense));
+	EXPECT_THAT(sparse.ToDense(), IsEqualMatrix(dense));
+	EXPECT_TRUE(IsEqualTo(sparse, dense));
+
+	// Views read elements through accessor
+	const MatrixView block{sparse, 2, 3, 10, 12};
+	EXPECT_THAT(block, IsEqualMatrix(MatrixView{dense, 2, 3, 10, 12}));
+	EXPECT_THAT(MatrixD{sparse + dense}, IsEqualMatrix(dense * 2.0));
+
+	EXPECT_THROW((void)sparse(40, 0), std::out_of_range);
+}
+
+TEST(SparseMatrixTest, BuilderTestSuccessful)
+{
+	SparseMatrixBuilder<double> builder{3, 4};
+	builder.Add(2, 1, 5).Add(0, 3, 1).Add(0, 0, 2).Add(2, 1, -1).Add(1, 2, 7);
+	const SparseMatrix<double> sparse = builder.Build();
+	EXPECT_EQ(sparse.NonZeros(), 4);
+	EXPECT_THAT(sparse, IsEqualMatrix(MatrixD{
+		{ 2, 0, 0, 1 },
+		{ 0, 0, 7, 0 },
+		{ 0, 4, 0, 0 }
+	}));
+	EXPECT_THROW(builder.Add(3, 0, 1), std::out_of_range);
+
+	const SparseMatrix<double> empty{5, 5};
+	EXPECT_EQ(empty.NonZeros(), 0);
+	EXPECT_THAT(empty.ToDense(), IsEqualMatrix(SparseLikeMatrix(5, 5) * 0.0));
+
+	// CSR arrays are checked
+	EXPECT_NO_THROW((SparseMatrix<double>{2, 3, {0, 1, 3}, {2, 0, 1}, {1, 2, 3}}));
+	EXPECT_THROW((SparseMatrix<double>{2, 3, {0, 2, 3}, {1, 0, 1}, {1, 2, 3}}), std::invalid_argument);
+	EXPECT_THROW((SparseMatrix<double>{2, 3, {0, 1, 3}, {2, 0, 3}, {1, 2, 3}}), std::invalid_argument);
+	EXPECT_THROW((SparseMatrix<double>{2, 3, {0, 1}, {2}, {1}}), std::invalid_argument);
+}
+
+TEST(SparseMatrixTest, SparseProductsTestSuccessful)
+{
+	const MatrixD dense = SparseLikeMatrix(70, 50);
+	const SparseMatrix<double> sparse = SparseMatrix<double>::FromDense(dense);
+
+	VectorD vector(50);
+	MatrixD column{50, 1};
+	for (std::size_t index = 0; index < 50; ++index)
+	{
+		vector[index] = static_cast<double>(index % 7) - 3;
+		column(index, 0) = vector[index];
+	}
+	const VectorD product = sparse * vector;
+	const MatrixD expected = dense * column;
+	ASSERT_EQ(product.size(), 70);
+	for (std::size_t row = 0; row < 70; ++row)
+	{
+		EXPECT_NEAR(product[row], expected(row, 0), 1e-9);
+	}
+
+	const MatrixD right = SparseLikeMatrix(50, 23) + SparseLikeMatrix(50, 23) * 0.5;
+	EXPECT_THAT(sparse * right, IsEqualMatrix(dense * right));
+	// Strided operands are read through accessors
+	EXPECT_THAT(sparse * TransposeView{algo::Transpose(right)}, IsEqualMatrix(dense * right));
+
+	EXPECT_THROW((void)(sparse * VectorD(70)), std::length_error);
+	EXPECT_THROW((void)(sparse * MatrixD{70, 2}), std::length_error);
+}
@@ -547,3 +547,162 @@ TEST(StaticMatrixTransposeTest, StaticMatrixTranspositionTest_1)
 	};
 	const MxLib::SMatrix<int, 1, 2> matrix2{MxLib::algo::Transpose(matrix1)};
 }
+
+template<typename T, std::size_t ROWS, std::size_t COLS>
+static MxLib::SMatrix<T, ROWS, COLS> FillSmall(int seed)
+{
+	MxLib::SMatrix<T, ROWS, COLS> matrix{};
+	for (std::size_t row = 0; row < ROWS; ++row)
+	{
+		for (std::size_t col = 0; col < COLS; ++col)
+		{
+			matrix(row, col) = static_cast<T>((static_cast<int>(row * 7 + col * 3) + seed) % 11 - 5);
+		}
+	}
+	return matrix;
+}
+
+template<typename T, std::size_t ROWS, std::size_t INNER, std::size_t COLS>
+static void ExpectSmallProductMatchesGeneric()
+{
+	const auto lMatrix = FillSmall<T, ROWS, INNER>(1);
+	const auto rMatrix = FillSmall<T, INNER, COLS>(4);
+	const MxLib::Matrix<T> expected{MxLib::Matrix<T>{lMatrix} * MxLib::Matrix<T>{rMatrix}};
+
+	const MxLib::SMatrix<T, ROWS, COLS> product = lMatrix * rMatrix;
+	EXPECT_THAT(product, IsEqualMatrix(expected));
+
+	MxLib::SMatrix<T, ROWS, COLS> accumulated{product};
+	Gemm(T{2}, lMatrix, rMatrix, T{1}, accumulated);
+	EXPECT_THAT(accumulated, IsEqualMatrix(MxLib::Matrix<T>{expected * T{3}}));
+
+	const MxLib::SMatrix<T, COLS, ROWS> transposed = MxLib::algo::Transpose(product);
+	EXPECT_THAT(transposed, IsEqualMatrix(MxLib::algo::Transpose(expected)));
+}
+
+TEST(StaticMatrixSmallKernelsTest, SmallProductAndTransposeTestSuccessful)
+{
+	ExpectSmallProductMatchesGeneric<float, 4, 4, 4>();
+	ExpectSmallProductMatchesGeneric<double, 4, 4, 4>();
+	ExpectSmallProductMatchesGeneric<float, 2, 3, 4>();
+	ExpectSmallProductMatchesGeneric<double, 3, 2, 3>();
+	ExpectSmallProductMatchesGeneric<int, 4, 3, 2>();
+	ExpectSmallProductMatchesGeneric<int, 2, 2, 2>();
+
+	// Kernels are usable in constant expressions
+	constexpr MxLib::Matrix2i rotation{
+		{ 0, -1 },
+		{ 1, 0 }
+	};
+	constexpr MxLib::Matrix2i halfTurn = rotation * rotation;
+	static_assert(halfTurn(0, 0) == -1 && halfTurn(0, 1) == 0 && halfTurn(1, 1) == -1);
+}
+TEST(StaticMatrixSmallKernelsTest, SmallDeterminantAndAdjointTestSuccessful)
+{
+	const auto matrix2 = FillSmall<int, 2, 2>(3);
+	const auto matrix3 = FillSmall<double, 3, 3>(2);
+	const auto matrix4 = FillSmall<long, 4, 4>(5);
+	EXPECT_EQ(MxLib::algo::Determinant(matrix2), MxLib::algo::DeterminantByExpansion(MxLib::Matrix<int>{matrix2}));
+	EXPECT_NEAR(MxLib::algo::Determinant(matrix3), MxLib::algo::DeterminantByExpansion(MxLib::MatrixD{matrix3}), 1e-9);
+	EXPECT_EQ(MxLib::algo::Determinant(matrix4), MxLib::algo::DeterminantByExpansion(MxLib::Matrix<long>{matrix4}));
+
+	const MxLib::Matrix4i matrix{
+		{ 2, 0, 1, 3 },
+		{ 1, 3, 2, 0 },
+		{ 1, 1, 2, 1 },
+		{ 0, 2, 1, 4 }
+	};
+	const MxLib::Matrix4i adjoint = MxLib::algo::Adjoint(matrix);
+	EXPECT_THAT(adjoint, IsEqualMatrix(MxLib::algo::Adjoint(MxLib::Matrix<int>{matrix})));
+}
+TEST(StaticMatrixSmallKernelsTest, SmallInverseTestSuccessful)
+{
+	const MxLib::Matrix4f matrix{
+		{ 4, 1, 0, 2 },
+		{ 1, 5, 1, 0 },
+		{ 0, 2, 6, 1 },
+		{ 1, 0, 1, 3 }
+	};
+	const MxLib::Matrix4f inversed = MxLib::algo::Inverse(matrix);
+	const MxLib::Matrix4f identity = matrix * inversed;
+	for (std::size_t row = 0; row < 4; ++row)
+	{
+		for (std::size_t col = 0; col < 4; ++col)
+		{
+			EXPECT_NEAR(identity(row, col), row == col ? 1.0F : 0.0F, 1e-5);
+		}
+	}
+
+	const MxLib::Matrix3d matrix3{
+		{ 7, 8, 9 },
+		{ 6, 5, 4 },
+		{ 3, 2, 2 }
+	};
+	const MxLib::Matrix3d expected{
+		{ -2/13.0, -2/13.0, 1 },
+		{ 0, 1, -2 },
+		{ 3/13.0, -10/13.0, 1 }
+	};
+	EXPECT_THAT(MxLib::algo::Inverse(matrix3), IsEqualMatrix(expected));
+
+	const MxLib::Matrix2i integers{
+		{ 2, 0 },
+		{ 0, 1 }
+	};
+	const MxLib::Matrix2i truncated{
+		{ 0, 0 },
+		{ 0, 1 }
+	};
+	EXPECT_THAT(MxLib::algo::Inverse(integers), IsEqualMatrix(truncated));
+}
+TEST(StaticMatrixSmallKernelsTest, SingularSmallInverseTestUnsuccessful)
+{
+	MxLib::Matrix3f matrix{
+		{ 1, 2, 3 },
+		{ 4, 5, 6 },
+		{ 7, 8, 9 }
+	};
+	EXPECT_THROW({(void)MxLib::algo::Inverse(matrix);}, std::runtime_error);
+	EXPECT_THROW({MxLib::algo::InverseInplace(matrix);}, std::runtime_error);
+	// Matrix is left untouched when inverse doesn't exist
+	EXPECT_EQ(matrix(2, 2), 9);
+}
+TEST(StaticMatrixSmallKernelsTest, SmallValuedSmallInverseTestSuccessful)
+{
+	// Determinant is tiny, but every pivot is well above tolerance, as dynamic matrix finds too
+	const MxLib::Matrix4d matrix{
+		{ 1e-3, 0, 0, 0 },
+		{ 0, 1e-3, 0, 0 },
+		{ 0, 0, 1, 0 },
+		{ 0, 0, 0, 1 }
+	};
+	const MxLib::MatrixD dynamicMatrix{matrix};
+
+	const MxLib::Matrix4d inversed = MxLib::algo::Inverse(matrix);
+	const MxLib::MatrixD dynamicInversed = MxLib::algo::Inverse(dynamicMatrix);
+	EXPECT_NEAR(inversed(0, 0), 1000.0, 1e-9);
+	EXPECT_NEAR(inversed(1, 1), 1000.0, 1e-9);
+	EXPECT_NEAR(inversed(3, 3), 1.0, 1e-12);
+	EXPECT_THAT(inversed, IsEqualMatrix(dynamicInversed));
+
+	// Pivot at rounding noise is singular for both of them
+	const MxLib::Matrix4d nearSingular{
+		{ 1e-17, 0, 0, 0 },
+		{ 0, 1, 0, 0 },
+		{ 0, 0, 1, 0 },
+		{ 0, 0, 0, 1 }
+	};
+	EXPECT_THROW({(void)MxLib::algo::Inverse(nearSingular);}, std::runtime_error);
+	EXPECT_THROW({(void)MxLib::algo::Inverse(MxLib::MatrixD{nearSingular});}, std::runtime_error);
+
+	const MxLib::Matrix2d wideRange{
+		{ 1e6, 0 },
+		{ 0, 1 }
+	};
+	const MxLib::Matrix2d expectedWideRange{
+		{ 1e-6, 0 },
+		{ 0, 1 }
+	};
+	EXPECT_THAT(MxLib::algo::Inverse(wideRange), IsEqualMatrix(expectedWideRange));
+	EXPECT_THAT(MxLib::algo::Inverse(MxLib::MatrixD{wideRange}), IsEqualMatrix(expectedWideRange));
+}
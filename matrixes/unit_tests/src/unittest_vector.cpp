@@ -21,3 +21,135 @@ TEST(VectorConstructionTest, VectorBasicConstructorTests)
 		ASSERT_EQ(vec[i], expected[i]);
 	}
 }
+
+static VectorD IndexedVector(std::size_t size)
+{
+	VectorD vector(size);
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		vector[index] = static_cast<double>(index % 5) - 2;
+	}
+	return vector;
+}
+
+TEST(VectorProductTest, MatrixVectorProductTestSuccessful)
+{
+	const MatrixD matrix = IndexedMatrix(37, 23, RowPadding::CacheLine);
+	const VectorD x = IndexedVector(23);
+	const VectorD y = IndexedVector(37);
+
+	const VectorD product = matrix * x;
+	ASSERT_EQ(product.size(), 37);
+	for (std::size_t row = 0; row < 37; ++row)
+	{
+		double expected = 0;
+		for (std::size_t col = 0; col < 23; ++col)
+		{
+			expected += matrix(row, col) * x[col];
+		}
+		EXPECT_DOUBLE_EQ(product[row], expected);
+	}
+
+	const VectorD transposedProduct = y * matrix;
+	ASSERT_EQ(transposedProduct.size(), 23);
+	for (std::size_t col = 0; col < 23; ++col)
+	{
+		double expected = 0;
+		for (std::size_t row = 0; row < 37; ++row)
+		{
+			expected += y[row] * matrix(row, col);
+		}
+		EXPECT_DOUBLE_EQ(transposedProduct[col], expected);
+	}
+
+	// Transposed views and expressions give the same products
+	const VectorD ofTransposed = TransposeView{matrix} * y;
+	const VectorD ofExpression = (matrix * 2.0) * x;
+	for (std::size_t col = 0; col < 23; ++col)
+	{
+		EXPECT_DOUBLE_EQ(ofTransposed[col], transposedProduct[col]);
+	}
+	for (std::size_t row = 0; row < 37; ++row)
+	{
+		EXPECT_DOUBLE_EQ(ofExpression[row], 2 * product[row]);
+	}
+
+	EXPECT_THROW((void)(matrix * y), std::length_error);
+	EXPECT_THROW((void)(x * matrix), std::length_error);
+}
+TEST(VectorProductTest, GemvIntoExistingVectorTestSuccessful)
+{
+	const MatrixD matrix = IndexedMatrix(19, 19);
+	const VectorD x = IndexedVector(19);
+	VectorD y = IndexedVector(19);
+	const VectorD previous = y;
+	const double *storage = y.data();
+
+	Gemv(2, matrix, x, -1, y);
+	EXPECT_EQ(y.data(), storage);
+	const VectorD product = matrix * x;
+	for (std::size_t row = 0; row < 19; ++row)
+	{
+		EXPECT_DOUBLE_EQ(y[row], 2 * product[row] - previous[row]);
+	}
+
+	// Output used as input is copied before it is overwritten
+	VectorD inplace = x;
+	Gemv(1, matrix, inplace, 0, inplace);
+	for (std::size_t row = 0; row < 19; ++row)
+	{
+		EXPECT_DOUBLE_EQ(inplace[row], product[row]);
+	}
+
+	// Rows and cols of matrixes are vectors as well
+	const MatrixD columns = IndexedMatrix(19, 4);
+	VectorD fromColumn(19);
+	Gemv(1, matrix, ColView{columns, 2}, 0, fromColumn);
+	VectorD fromRow(4);
+	Gemv(1, columns, RowView{matrix, 5}, 0, fromRow, Transposition::Transposed);
+	for (std::size_t row = 0; row < 19; ++row)
+	{
+		double expected = 0;
+		for (std::size_t col = 0; col < 19; ++col)
+		{
+			expected += matrix(row, col) * columns(col, 2);
+		}
+		EXPECT_DOUBLE_EQ(fromColumn[row], expected);
+	}
+	for (std::size_t col = 0; col < 4; ++col)
+	{
+		double expected = 0;
+		for (std::size_t row = 0; row < 19; ++row)
+		{
+			expected += matrix(5, row) * columns(row, col);
+		}
+		EXPECT_DOUBLE_EQ(fromRow[col], expected);
+	}
+
+	VectorD wrongSize(3);
+	EXPECT_THROW(Gemv(1, matrix, x, 0, wrongSize), std::length_error);
+	EXPECT_THROW(Gemv(1, matrix, MatrixD{2, 19}, 0, y), std::length_error);
+}
+// Products with view operands return matrixes and go through the same kernels
+TEST(VectorProductTest, ViewProductsTestSuccessful)
+{
+	const MatrixD matrix = IndexedMatrix(29, 31);
+	const MatrixD other = IndexedMatrix(31, 29, RowPadding::CacheLine);
+
+	const MatrixD byColumn = matrix * ColView{other, 7};
+	const MatrixD byRow = RowView{matrix, 3} * other;
+	ASSERT_EQ(byColumn.Rows(), 29);
+	ASSERT_EQ(byRow.Cols(), 29);
+	for (std::size_t row = 0; row < 29; ++row)
+	{
+		double column = 0;
+		double fromRow = 0;
+		for (std::size_t iter = 0; iter < 31; ++iter)
+		{
+			column += matrix(row, iter) * other(iter, 7);
+			fromRow += matrix(3, iter) * other(iter, row);
+		}
+		EXPECT_DOUBLE_EQ(byColumn(row, 0), column);
+		EXPECT_DOUBLE_EQ(byRow(0, row), fromRow);
+	}
+}